@@ -3,22 +3,57 @@ setlocal
 echo Building Doogo...
 
 :: --- CONFIGURATION ---
-:: Change this if Raylib is installed somewhere else (e.g. D:\raylib)
+:: Change this if Raylib is installed somewhere else (e.g. D:\raylib), only its compiler (w64devkit) is used
 set RAYLIB_ROOT=C:\raylib
 :: ---------------------
 
 :: 1. Add the compiler (w64devkit) to the PATH temporarily
 set PATH=%RAYLIB_ROOT%\w64devkit\bin;%PATH%
 
-:: 2. Compile
-:: We use %RAYLIB_ROOT% to make sure we find the include (-I) and library (-L) files
-gcc src\main.c src\player.c src\world.c src\ui.c src\screens.c -o Doogo.exe -O1 -Wall -std=c99 -Wno-missing-braces -I src -I %RAYLIB_ROOT%\raylib\src -L %RAYLIB_ROOT%\raylib\src -lraylib -lopengl32 -lgdi32 -lwinmm
+:: 2. Build raylib from raylib\src, the game uses functions only available in this copy (not in the installed raylib)
+:: Release links raylib\src\libraylib.a, "build.bat debug" links a debug raylib
+:: built into build\debug with memory tracking (F3 memory overlay, leak report on exit)
+set RAYLIB_SRC=%~dp0raylib\src
+set RAYLIB_MODE=RELEASE
+set RAYLIB_LIB=%RAYLIB_SRC%
+set RAYLIB_FLAGS=
+set GAME_FLAGS=-O1
+if /I not "%1"=="debug" goto :raylib
 
-:: 3. Check for errors
+set RAYLIB_MODE=DEBUG
+set RAYLIB_LIB=%~dp0build\debug
+set RAYLIB_FLAGS=-DSUPPORT_MEMORY_TRACKING
+set GAME_FLAGS=-g -O0 -DDOOGO_DEBUG
+
+:raylib
+echo Building raylib (%RAYLIB_MODE%)...
+if not exist "%RAYLIB_LIB%" mkdir "%RAYLIB_LIB%"
+if not exist build mkdir build
+
+:: Both modes compile their objects in raylib\src, remove them when the mode changes
+set LAST_MODE=
+if exist build\raylib_mode.txt set /p LAST_MODE=<build\raylib_mode.txt
+if not "%LAST_MODE%"=="%RAYLIB_MODE%" del /q "%RAYLIB_SRC%\*.o" 2>nul
+echo %RAYLIB_MODE%>build\raylib_mode.txt
+
+make -C "%RAYLIB_SRC%" PLATFORM=PLATFORM_DESKTOP RAYLIB_BUILD_MODE=%RAYLIB_MODE% CUSTOM_CFLAGS=%RAYLIB_FLAGS% RAYLIB_RELEASE_PATH="%RAYLIB_LIB%"
+if %ERRORLEVEL% NEQ 0 goto :failed
+
+:: 3. Compile
+gcc src\main.c src\player.c src\world.c src\ui.c src\screens.c src\terrain.c src\pack.c src\texgen.c src\atlas.c -o Doogo.exe %GAME_FLAGS% -Wall -std=c99 -Wno-missing-braces -I src -I "%RAYLIB_SRC%" -L "%RAYLIB_LIB%" -lraylib -lopengl32 -lgdi32 -lwinmm -lpthread
+
+if %ERRORLEVEL% NEQ 0 goto :failed
+
+:: 4. Build the pack builder and pack assets\ into doogo.pak (game falls back to loose files without it)
+gcc tools\pack_builder.c src\pack.c -o pack_builder.exe -O1 -Wall -std=c99 -Wno-missing-braces -I src -I "%RAYLIB_SRC%" -L "%RAYLIB_LIB%" -lraylib -lopengl32 -lgdi32 -lwinmm -lpthread
+if %ERRORLEVEL% EQU 0 pack_builder.exe assets doogo.pak
+
+:failed
+:: 5. Check for errors
 if %ERRORLEVEL% NEQ 0 (
     echo.
     echo [ERROR] Build Failed! 
-    echo Please check if Raylib is actually installed at: %RAYLIB_ROOT%
+    echo Please check if w64devkit is actually installed at: %RAYLIB_ROOT%\w64devkit
 ) else (
     echo.
     echo Build Success! Run Doogo.exe to play.
@@ -91,6 +91,17 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_SCREEN_CAPTURES             8       // Maximum number of screen captures in flight (pixel buffers)
+#define SCREEN_CAPTURE_LATENCY          3       // Frames between a screen capture and its pixels readback
+
+#define WAIT_OVERSHOOT_SAMPLES         64       // Wake up lateness samples used to learn the spin margin (SUPPORT_PARTIALBUSY_WAIT_LOOP)
+#define WAIT_OVERSHOOT_PERCENTILE       0.95    // Wake up lateness percentile covered by the spin margin
+#define WAIT_SPIN_MARGIN                0.001   // Initial spin margin in seconds, until lateness samples are measured
+#define WAIT_SPIN_MARGIN_MIN            0.0002  // Minimum spin margin in seconds
+#define WAIT_SPIN_MARGIN_MAX            0.002   // Maximum spin margin in seconds, lateness above it is not waited busy
+#define WAIT_SPIN_MARGIN_RATIO          0.05    // Maximum spin margin as a ratio of the wait time, a longer busy wait is more likely preempted
+#define FRAME_PACING_TOLERANCE          0.0005  // Time in seconds a frame can go over target time before counted as missed
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -174,13 +185,15 @@
 #define SUPPORT_FILEFORMAT_DDS      1
 //#define SUPPORT_FILEFORMAT_HDR      1
 //#define SUPPORT_FILEFORMAT_PIC          1
-//#define SUPPORT_FILEFORMAT_KTX      1
+#define SUPPORT_FILEFORMAT_KTX      1
 //#define SUPPORT_FILEFORMAT_ASTC     1
 //#define SUPPORT_FILEFORMAT_PKM      1
 //#define SUPPORT_FILEFORMAT_PVR      1
 
-// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi)
+// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi, .dds, .ktx)
 #define SUPPORT_IMAGE_EXPORT            1
+// Support image compression to GPU block formats (DXT1/DXT3/DXT5, ETC1/ETC2/EAC) with ImageCompress() and ImageFormat()
+#define SUPPORT_IMAGE_COMPRESSION       1
 // Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 #define SUPPORT_IMAGE_GENERATION        1
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
@@ -213,6 +226,9 @@
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define MAX_GLYPH_INDEX_TABLES          8       // Maximum number of fonts with a codepoint lookup table: GetGlyphIndex()
+#define DYNAMIC_FONT_ATLAS_WIDTH      512       // Dynamic font atlas width, height starts at width/4
+#define DYNAMIC_FONT_ATLAS_MAX_HEIGHT 4096      // Dynamic font atlas maximum height, doubled when full
 
 
 //------------------------------------------------------------------------------------
@@ -228,10 +244,16 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Optimize meshes on load/generation: weld vertices into an index buffer and reorder
+// triangles and vertices for GPU post-transform cache, overdraw and vertex fetch [OptimizeMesh()]
+#define SUPPORT_MESH_OPTIMIZATION       1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define MESH_VERTEX_CACHE_SIZE         16       // Post-transform vertex cache size (FIFO) used to measure ACMR
+#define MAX_ANIMATION_POSE_CACHE       32       // Maximum animation poses (bone matrices) cached, shared by models at same animation frame
+#define ANIMATION_POSE_BLEND_STEPS     16       // Interpolation steps between two animation frames, fractional frames are rounded to a step
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -250,6 +272,8 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Decode music streams on a background thread, UpdateMusicStream() is not required
+#define SUPPORT_MUSIC_DECODER_THREAD    1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -257,7 +281,11 @@
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    64    // Maximum number of sound voices playing at once (voice pool allocated on device init)
+#define AUDIO_COMMAND_QUEUE_SIZE        1024    // Maximum pending commands to the mixing thread (power of two)
+#define AUDIO_SOUND_MIN_DISTANCE        2.0f    // Positional sounds default distance to start attenuation
+#define AUDIO_SOUND_MAX_DISTANCE      100.0f    // Positional sounds default distance to be culled (not mixed)
+#define AUDIO_MUSIC_BUFFER_DEPTH_MS      200    // Music decoded ahead of the mixer (stream buffer length, in milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -268,10 +296,24 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Internal worker threads pool used to split heavy CPU jobs (i.e. mesh skinning) across cores,
+// and background thread for tasks not waited for (i.e. screenshots and gif frames encoding)
+// NOTE: Requires pthreads, jobs and tasks run on calling thread if not available
+#define SUPPORT_WORKER_THREADS          1
+// Track raylib memory allocations (RL_MALLOC, RL_CALLOC, RL_REALLOC, RL_FREE) by subsystem:
+// live bytes, peak and allocation totals, see GetMemoryStats() and TraceMemoryStats()
+// NOTE: Allocations are recorded in a pointer table (no headers), memory allocated or freed
+// with plain malloc()/free() across raylib functions keeps working, just not accounted
+// WARNING: Debug feature, every allocation takes a lock and updates the table, enable it on debug builds only
+//#define SUPPORT_MEMORY_TRACKING         1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS              8       // Max number of worker threads (calling thread also works on jobs)
+#define MAX_WORKER_TASKS               16       // Max number of queued background tasks
+#define FRAME_MEMORY_SIZE           65536       // Frame memory arena initial size in bytes, grown to frames high-water mark: MemAllocFrame()
+#define FRAME_MEMORY_MAX_SIZE    16777216       // Frame memory arena max bytes allocated in one frame, MemAllocFrame() returns NULL over it
 
 
 // Enable partial support for clipboard image, only working on SDL3 or
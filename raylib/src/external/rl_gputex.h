@@ -66,7 +66,8 @@ RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
-RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+RLAPI int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as DDS file
+RLAPI int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
 #if defined(__cplusplus)
 }
@@ -248,8 +249,26 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             }
             else if ((header->ddspf.flags == 0x41) && (header->ddspf.rgb_bit_count == 32)) // DDS_RGBA, no compressed
             {
-                int data_size = image_pixel_size*4*sizeof(unsigned char);
-                if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
+                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+                // Calculate data size, including all mipmaps
+                // NOTE: Levels are summed, base level size + 1/3 is not exact (levels sizes are rounded down)
+                int data_size = 0;
+                for (int i = 0, w = *width, h = *height; i < *mips; i++)
+                {
+                    data_size += get_pixel_data_size(w, h, *format);
+                    w /= 2; h /= 2;
+                    if (w < 1) w = 1;
+                    if (h < 1) h = 1;
+                }
+
+                if ((file_data_ptr + data_size) > (file_data + file_size))
+                {
+                    LOG("WARNING: IMAGE: DDS file data size not valid");
+                    *mips = 1;
+                    data_size = image_pixel_size*4;
+                }
+
                 image_data = RL_MALLOC(data_size);
 
                 memcpy(image_data, file_data_ptr, data_size);
@@ -258,28 +277,16 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
 
                 // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
                 // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
-                // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image_pixel_size*4; i += 4)
+                // So, we must realign B8G8R8A8 to R8G8B8A8, on every mipmap level
+                for (int i = 0; i < data_size; i += 4)
                 {
                     blue = ((unsigned char *)image_data)[i];
                     ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
                     ((unsigned char *)image_data)[i + 2] = blue;
                 }
-
-                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
             }
             else if (((header->ddspf.flags == 0x04) || (header->ddspf.flags == 0x05)) && (header->ddspf.fourcc > 0)) // Compressed
             {
-                int data_size = 0;
-
-                // Calculate data size, including all mipmaps
-                if (header->mipmap_count > 1) data_size = header->pitch_or_linear_size + header->pitch_or_linear_size / 3;
-                else data_size = header->pitch_or_linear_size;
-
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-                memcpy(image_data, file_data_ptr, data_size);
-
                 switch (header->ddspf.fourcc)
                 {
                     case FOURCC_DXT1:
@@ -291,12 +298,159 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     case FOURCC_DXT5: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
                     default: break;
                 }
+
+                // Calculate data size, including all mipmaps
+                // NOTE: Smallest mipmaps still take a full block, size can't be estimated from base level size
+                int data_size = 0;
+                for (int i = 0, w = *width, h = *height; i < *mips; i++)
+                {
+                    data_size += get_pixel_data_size(w, h, *format);
+                    w /= 2; h /= 2;
+                    if (w < 1) w = 1;
+                    if (h < 1) h = 1;
+                }
+
+                if ((file_data_ptr + data_size) > (file_data + file_size))
+                {
+                    LOG("WARNING: IMAGE: DDS file data size not valid");
+                    *mips = 1;
+                    data_size = header->pitch_or_linear_size;
+                }
+
+                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+
+                memcpy(image_data, file_data_ptr, data_size);
             }
         }
     }
 
     return image_data;
 }
+
+// Save image data as DDS file
+// NOTE: Supported formats: DXT1, DXT3, DXT5 and uncompressed R8G8B8A8, mipmaps data is saved after base level
+int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+{
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourcc;
+        unsigned int rgb_bit_count;
+        unsigned int r_bit_mask;
+        unsigned int g_bit_mask;
+        unsigned int b_bit_mask;
+        unsigned int a_bit_mask;
+    } dds_pixel_format;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitch_or_linear_size;
+        unsigned int depth;
+        unsigned int mipmap_count;
+        unsigned int reserved1[11];
+        dds_pixel_format ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } dds_header;
+
+    dds_header header = { 0 };
+    header.size = sizeof(dds_header);
+    header.flags = 0x1 | 0x2 | 0x4 | 0x1000;        // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+    header.height = height;
+    header.width = width;
+    header.mipmap_count = (mipmaps > 1)? mipmaps : 0;
+    header.ddspf.size = sizeof(dds_pixel_format);
+    header.caps = 0x1000;                           // DDSCAPS_TEXTURE
+
+    if (mipmaps > 1)
+    {
+        header.flags |= 0x20000;                    // DDSD_MIPMAPCOUNT
+        header.caps |= 0x8 | 0x400000;              // DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
+    }
+
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: header.ddspf.flags = 0x04; header.ddspf.fourcc = 0x31545844; break;     // DDPF_FOURCC, "DXT1"
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.ddspf.flags = 0x05; header.ddspf.fourcc = 0x31545844; break;    // DDPF_FOURCC | DDPF_ALPHAPIXELS, "DXT1"
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.ddspf.flags = 0x04; header.ddspf.fourcc = 0x33545844; break;    // DDPF_FOURCC, "DXT3"
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.ddspf.flags = 0x04; header.ddspf.fourcc = 0x35545844; break;    // DDPF_FOURCC, "DXT5"
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            header.ddspf.flags = 0x41;              // DDPF_RGB | DDPF_ALPHAPIXELS
+            header.ddspf.rgb_bit_count = 32;
+            header.ddspf.r_bit_mask = 0x00ff0000;
+            header.ddspf.g_bit_mask = 0x0000ff00;
+            header.ddspf.b_bit_mask = 0x000000ff;
+            header.ddspf.a_bit_mask = 0xff000000;
+        } break;
+        default:
+        {
+            LOG("WARNING: IMAGE: Pixel format not supported for DDS export (%i)", format);
+            return false;
+        }
+    }
+
+    if (header.ddspf.fourcc != 0) header.flags |= 0x80000;     // DDSD_LINEARSIZE
+    else header.flags |= 0x8;                                   // DDSD_PITCH
+    header.pitch_or_linear_size = (header.ddspf.fourcc != 0)? get_pixel_data_size(width, height, format) : width*4;
+
+    int image_data_size = 0;
+    for (int i = 0, w = width, h = height; i < mipmaps; i++)
+    {
+        image_data_size += get_pixel_data_size(w, h, format);
+        w /= 2; h /= 2;
+        if (w < 1) w = 1;
+        if (h < 1) h = 1;
+    }
+
+    int data_size = 4 + sizeof(dds_header) + image_data_size;
+    unsigned char *file_data = RL_CALLOC(data_size, 1);
+
+    memcpy(file_data, "DDS ", 4);
+    memcpy(file_data + 4, &header, sizeof(dds_header));
+    memcpy(file_data + 4 + sizeof(dds_header), data, image_data_size);
+
+    // NOTE: DirectX expects B8G8R8A8 in memory, R8G8B8A8 must be reordered (same as loading)
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        unsigned char *pixels = file_data + 4 + sizeof(dds_header);
+        for (int i = 0; i < image_data_size; i += 4)
+        {
+            unsigned char red = pixels[i];
+            pixels[i] = pixels[i + 2];
+            pixels[i + 2] = red;
+        }
+    }
+
+    // Save file data to file
+    int success = false;
+    FILE *file = fopen(file_name, "wb");
+
+    if (file != NULL)
+    {
+        int count = (int)fwrite(file_data, sizeof(unsigned char), data_size, file);
+
+        if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
+        else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+        else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
+
+        int result = fclose(file);
+        if ((result == 0) && (count == data_size)) success = true;
+    }
+    else LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
+
+    RL_FREE(file_data);    // Free file data buffer
+
+    return success;
+}
 #endif
 
 #if defined(RL_GPUTEX_SUPPORT_PKM)
@@ -438,12 +592,36 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
+            // NOTE: Every mipmap level is preceded by its data size, levels are packed together
+            int data_size = 0;
+            unsigned char *level_ptr = file_data_ptr;
+            for (int i = 0; i < *mips; i++)
+            {
+                if ((level_ptr + sizeof(int)) > (file_data + file_size)) { *mips = i; break; }
+
+                unsigned int level_size = 0;
+                memcpy(&level_size, level_ptr, sizeof(unsigned int));
+                if ((level_ptr + sizeof(int) + level_size) > (file_data + file_size)) { *mips = i; break; }
+
+                data_size += level_size;
+                level_ptr += sizeof(int) + ((level_size + 3) & ~3u);    // Levels are 4 bytes aligned
+            }
+            if (*mips < 1) *mips = 1;
 
             image_data = RL_MALLOC(data_size*sizeof(unsigned char));
 
-            memcpy(image_data, file_data_ptr, data_size);
+            unsigned char *image_data_ptr = (unsigned char *)image_data;
+            for (int i = 0; i < *mips; i++)
+            {
+                unsigned int level_size = 0;
+                memcpy(&level_size, file_data_ptr, sizeof(unsigned int));
+                if (level_size > (unsigned int)data_size) break;
+
+                memcpy(image_data_ptr, file_data_ptr + sizeof(int), level_size);
+                image_data_ptr += level_size;
+                data_size -= level_size;
+                file_data_ptr += sizeof(int) + ((level_size + 3) & ~3u);
+            }
 
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
@@ -488,8 +666,10 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
+        data_size += sizeof(unsigned int) + get_pixel_data_size(w, h, format);     // Every level is preceded by its size
         w /= 2; h /= 2;
+        if (w < 1) w = 1;
+        if (h < 1) h = 1;
     }
 
     unsigned char *file_data = RL_CALLOC(data_size, 1);
@@ -505,7 +685,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     // Get the image header
     memcpy(header.id, ktx_identifier, 12);  // KTX 1.1 signature
-    header.endianness = 0;
+    header.endianness = 0x04030201;
     header.gl_type = 0;                     // Obtained from format
     header.gl_type_size = 1;
     header.gl_format = 0;                   // Obtained from format
@@ -519,12 +699,21 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     header.key_value_data_size = 0;         // No extra data after the header
 
-    rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
-    header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
+    // NOTE: ETC formats are set directly, rlGetGlTextureFormats() requires a GL context supporting them,
+    // not available at asset build time
+    if (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) { header.gl_internal_format = 0x8D64; header.gl_base_internal_format = 0x1907; }            // GL_ETC1_RGB8_OES, GL_RGB
+    else if (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) { header.gl_internal_format = 0x9274; header.gl_base_internal_format = 0x1907; }       // GL_COMPRESSED_RGB8_ETC2, GL_RGB
+    else if (format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA) { header.gl_internal_format = 0x9278; header.gl_base_internal_format = 0x1908; } // GL_COMPRESSED_RGBA8_ETC2_EAC, GL_RGBA
+    else
+    {
+        rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
+        header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
+    }
 
     // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
 
-    if (header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
+    // NOTE: rlGetGlTextureFormats() leaves internal format as 0 for formats not supported by current GL version
+    if (header.gl_internal_format == 0) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", format);
     else
     {
         memcpy(file_data_ptr, &header, sizeof(ktx_header));
@@ -537,15 +726,17 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         // Save all mipmaps data
         for (int i = 0; i < mipmaps; i++)
         {
-            unsigned int data_size = get_pixel_data_size(temp_width, temp_height, format);
+            unsigned int level_size = (unsigned int)get_pixel_data_size(temp_width, temp_height, format);
 
-            memcpy(file_data_ptr, &data_size, sizeof(unsigned int));
-            memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
+            memcpy(file_data_ptr, &level_size, sizeof(unsigned int));
+            memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, level_size);
 
             temp_width /= 2;
             temp_height /= 2;
-            data_offset += data_size;
-            file_data_ptr += (4 + data_size);
+            if (temp_width < 1) temp_width = 1;
+            if (temp_height < 1) temp_height = 1;
+            data_offset += level_size;
+            file_data_ptr += (4 + level_size);
         }
     }
 
@@ -555,14 +746,14 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     if (file != NULL)
     {
-        unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), data_size, file);
+        int count = (int)fwrite(file_data, sizeof(unsigned char), data_size, file);
 
         if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
         else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
         else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
 
         int result = fclose(file);
-        if (result == 0) success = true;
+        if ((result == 0) && (count == data_size)) success = true;
     }
     else LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
 
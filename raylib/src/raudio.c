@@ -78,6 +78,7 @@
     #if !defined(EXTERNAL_CONFIG_FLAGS)
         #include "config.h"     // Defines module configuration flags
     #endif
+    #define RL_MEMORY_TAG MEMORY_TAG_AUDIO  // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
     #include "utils.h"          // Required for: fopen() Android mapping
 #endif
 
@@ -183,6 +184,7 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf() [Used in SetAudioListener(), positional sounds]
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -296,7 +298,44 @@ typedef struct tagBITMAPINFOHEADER {
 #endif
 
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
-    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
+    #define MAX_AUDIO_BUFFER_POOL_CHANNELS    64    // Audio pool channels, sound voices playing at once
+#endif
+#ifndef AUDIO_SOUND_MIN_DISTANCE
+    #define AUDIO_SOUND_MIN_DISTANCE        2.0f    // Positional sounds distance to start attenuation
+#endif
+#ifndef AUDIO_SOUND_MAX_DISTANCE
+    #define AUDIO_SOUND_MAX_DISTANCE      100.0f    // Positional sounds distance to be culled
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE        1024    // Commands queue size, must be a power of two
+#endif
+#ifndef AUDIO_MUSIC_BUFFER_DEPTH_MS
+    #define AUDIO_MUSIC_BUFFER_DEPTH_MS      200    // Music decoded ahead of the mixer (in milliseconds)
+#endif
+
+// Single-threaded web audio runs the mixing callback on the main thread,
+// commands must be applied immediately, waiting for the mixer would never return
+#if defined(__EMSCRIPTEN__) && !defined(MA_ENABLE_AUDIO_WORKLETS)
+    #define AUDIO_MIXER_ON_MAIN_THREAD
+#endif
+
+// Music decoder thread requires threads support, otherwise UpdateMusicStream() decodes on program thread
+#if defined(SUPPORT_MUSIC_DECODER_THREAD) && (defined(MA_NO_THREADING) || (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)))
+    #undef SUPPORT_MUSIC_DECODER_THREAD
+#endif
+
+// SIMD instruction set used by the mixer, stereo frames are mixed in blocks of 8 samples
+#if !defined(AUDIO_MIXER_DISABLE_SIMD)
+    #if defined(__AVX__)
+        #define AUDIO_MIXER_SIMD_AVX
+        #include <immintrin.h>          // Required for: AVX intrinsics
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define AUDIO_MIXER_SIMD_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define AUDIO_MIXER_SIMD_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics
+    #endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -338,6 +377,23 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Commands posted by the program to the mixing thread
+// NOTE: Mixer owns the buffers list and the playback state, program never writes them directly
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add buffer to the mixing list
+    AUDIO_COMMAND_UNTRACK,          // Remove buffer from the mixing list
+    AUDIO_COMMAND_PLAY,             // Play buffer from the start
+    AUDIO_COMMAND_PLAY_VOICE,       // Play source buffer data and settings on a pool voice
+    AUDIO_COMMAND_STOP,             // Stop buffer, playing or paused
+    AUDIO_COMMAND_PAUSE,            // Pause buffer
+    AUDIO_COMMAND_RESUME,           // Resume buffer
+    AUDIO_COMMAND_VOLUME,           // Set buffer volume
+    AUDIO_COMMAND_PITCH,            // Set buffer pitch
+    AUDIO_COMMAND_PAN,              // Set buffer pan
+    AUDIO_COMMAND_CALLBACK,         // Set buffer filling callback
+    AUDIO_COMMAND_PROCESSOR         // Replace processors list (buffer or mixed output if buffer is NULL)
+} AudioCommandType;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -348,13 +404,31 @@ struct rAudioBuffer {
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
+    float gains[2];                 // Channel gains applied on last mix, ramped to volume/pan on next mix
+
+    float position[3];              // World position for positional voices, written by program thread
+    float distance[2];              // Attenuation min/max distances, max is 0 for non-positional buffers
+    float spatialGain;              // Distance attenuation computed by the mixer
+    float spatialPan;               // Pan from listener orientation computed by the mixer
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    float requestedVolume;          // Volume requested by program
+    bool requestedPlaying;          // Playing state requested by program, valid while commands are pending
+    bool requestedPaused;           // Paused state requested by program, valid while commands are pending
+    ma_uint32 lastCommand;          // Commands queue position after the last state command for this buffer
+
+    int priority;                   // Sound priority for voice stealing
+    rAudioBuffer *source;           // Sound buffer played by this voice (pool voices only), NULL if free
+    unsigned int playOrder;         // Voice play order, oldest voices are stolen first
+    struct rSoundCacheEntry *cache; // Sound cache entry owning the data, NULL if data is owned by the buffer
+
+    ma_bool32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer)
+    ma_bool32 isStreamEnding;       // Music stream last frames decoded, mixer stops once they are played
+    ma_uint32 underruns;            // Stream sub-buffers not refilled in time, counted by the mixer
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
@@ -375,21 +449,90 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio command, state change for the mixing thread
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target buffer
+    float value;                    // Volume, pitch or pan value
+    AudioCallback callback;         // Buffer filling callback
+    rAudioProcessor *processor;     // Processors list, immutable once posted
+    AudioBuffer *source;            // Sound buffer to play on a pool voice
+    float distance[2];              // Positional voice min/max distances, max is 0 for non-positional voices
+} AudioCommand;
+
+// Sound cache entry, converted data shared by all sounds loaded from the same file
+typedef struct rSoundCacheEntry {
+    char *fileName;                 // Sound file name, cache key
+    unsigned int sampleRate;        // Device sample rate data was converted to, cache key
+    unsigned char *data;            // Sound data, device format and channels
+    unsigned int frameCount;        // Sound data frame count
+    int refCount;                   // Sounds using this data
+    struct rSoundCacheEntry *next;  // Next cache entry on the list
+} rSoundCacheEntry;
+
+// Music decoder, keeps a music stream buffers filled ahead of the mixer
+typedef struct rMusicDecoder {
+    Music music;                    // Music copy, context data is only accessed with decoder lock held
+    ma_bool32 looping;              // Music looping, updated by program thread
+    double decodeTime;              // Accumulated sub-buffers decoding time (in seconds)
+    double decodeTimeMax;           // Longest sub-buffer decoding time (in seconds)
+    unsigned int decodeCount;       // Sub-buffers decoded
+    struct rMusicDecoder *next;     // Next music decoder on the list
+} rMusicDecoder;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Offline device, mixed on RenderAudioFrames() calls, no audio hardware used
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE]; // Commands ring buffer, single-producer/single-consumer
+        ma_uint32 writeIndex;       // Commands posted, written by program thread
+        ma_uint32 readIndex;        // Commands processed, written by mixing thread
+        ma_spinlock lock;           // Serializes program threads posting commands, never taken by the mixer
+        bool isMixerRunning;        // Mixing thread processes the queue, otherwise commands are applied on posting
+    } Command;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioBuffer **voices;       // Voices shared by all sounds, allocated on device init
+        int count;                  // Number of voices in the pool
+        unsigned int playCounter;   // Plays counter, used to find oldest voice
+        unsigned int steals;        // Plays that took over a voice in use
+        unsigned int rejectedPlays; // Plays dropped because all voices had higher priority
+    } Voice;
+    struct {
+        float position[3];          // Listener position, written by program thread
+        float right[3];             // Listener right direction, written by program thread
+    } Listener;
+    struct {
+        rMusicDecoder *first;       // Decoders of loaded music streams
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        ma_mutex lock;              // Held while decoding, seeking or unloading music streams
+        ma_thread thread;           // Decoder thread, refills playing music streams
+        ma_bool32 quit;             // Decoder thread exit request
+        bool isThreadRunning;       // Decoder thread running, UpdateMusicStream() does nothing
+#endif
+    } Music;
+    struct {
+        rSoundCacheEntry *first;    // Sounds data loaded from files
+        char *directory;            // Disk cache directory for converted sounds (QOA), NULL if disabled
+    } SoundCache;
+    struct {
+        unsigned int sampleRate;    // Requested sample rate, device default if 0
+        char *fileName;             // WAV file to save rendered frames on device close, NULL if not required
+        float *frames;              // Rendered frames, device format
+        unsigned int frameCount;    // Rendered frames count
+        unsigned int capacity;      // Allocated frames capacity
+    } Offline;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +546,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Listener.right = { 1.0f, 0.0f, 0.0f },
     .mixedProcessor = NULL
 };
 
@@ -417,10 +561,49 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
-
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static void MixAudioFramesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *startGains, const float *endGains);
+static void GetAudioBufferGains(const AudioBuffer *buffer, float *gains);
+static bool UpdateAudioBufferSpatial(AudioBuffer *buffer);
+static void SkipAudioBufferFrames(AudioBuffer *buffer, ma_uint32 frameCount);
+
+// Commands queue between program and mixing thread
+static ma_uint32 PostAudioCommand(AudioCommand command);
+static void PostAudioBufferState(AudioBuffer *buffer, int type);
+static bool IsAudioCommandPending(ma_uint32 position);
+static void WaitAudioCommands(ma_uint32 position);
+static void ProcessAudioCommands(void);
+static void ProcessAudioCommand(const AudioCommand *command);
+static void SetAudioProcessors(AudioBuffer *buffer, rAudioProcessor *processors);
+static rAudioProcessor *AddAudioProcessor(const rAudioProcessor *processors, AudioCallback process);
+static rAudioProcessor *RemoveAudioProcessor(const rAudioProcessor *processors, AudioCallback process);
+static void StopAudioBufferInMixer(AudioBuffer *buffer);
+
+// Sounds voice pool, voices reference the sound data, no allocation on play
+static bool IsAudioVoiceInUse(AudioBuffer *voice);
+static AudioBuffer *PlayAudioVoice(AudioBuffer *source, const Vector3 *position);
+static void SetAudioVoicesState(AudioBuffer *source, int type);
+static void SetAudioVoicesValue(AudioBuffer *source, int type, float value);
+static void ReleaseAudioVoices(AudioBuffer *source);
+
+static Sound LoadSoundFromCache(rSoundCacheEntry *entry);
+static rSoundCacheEntry *GetSoundCacheEntry(const char *fileName);
+static void AddSoundCacheEntry(const char *fileName, Sound sound);
+static void ReleaseSoundCacheEntry(rSoundCacheEntry *entry);
+static bool DetachSoundCacheEntry(AudioBuffer *buffer);
+static Wave LoadSoundDiskCache(const char *fileName);
+static void SaveSoundDiskCache(const char *fileName, Sound sound);
+
+static AudioStream LoadMusicAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels);
+static void AttachMusicDecoder(Music music);
+static void DetachMusicDecoder(Music music);
+static rMusicDecoder *GetMusicDecoder(Music music);
+static void LockMusicDecoder(void);
+static void UnlockMusicDecoder(void);
+static void UpdateMusicDecoder(rMusicDecoder *decoder);
+static void RewindMusicStream(Music music);
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data);
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -462,7 +645,10 @@ void InitAudioDevice(void)
     ma_context_config ctxConfig = ma_context_config_init();
     ma_log_callback_init(OnLog, NULL);
 
-    ma_result result = ma_context_init(NULL, 0, &ctxConfig, &AUDIO.System.context);
+    // Offline device only uses the null backend, no audio hardware or sound server is ever opened
+    ma_backend nullBackend = ma_backend_null;
+
+    ma_result result = ma_context_init(AUDIO.System.isOffline? &nullBackend : NULL, AUDIO.System.isOffline? 1 : 0, &ctxConfig, &AUDIO.System.context);
     if (result != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize context");
@@ -478,7 +664,7 @@ void InitAudioDevice(void)
     config.capture.pDeviceID = NULL;  // NULL for the default capture AUDIO.System.device
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
-    config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.sampleRate = AUDIO.System.isOffline? AUDIO.Offline.sampleRate : AUDIO_DEVICE_SAMPLE_RATE;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
 
@@ -490,27 +676,69 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+    // Init sounds voice pool, voices reference sounds data and are reused on every PlaySound()
+    AUDIO.Voice.voices = (AudioBuffer **)RL_CALLOC(MAX_AUDIO_BUFFER_POOL_CHANNELS, sizeof(AudioBuffer *));
+    AUDIO.Voice.count = 0;
+
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
     {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
+        AudioBuffer *voice = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        if (voice == NULL) break;
+
+        AUDIO.Voice.voices[AUDIO.Voice.count] = voice;
+        AUDIO.Voice.count++;
     }
 
+    // Mixing happens on a separate thread which means we need to synchronize. Program never touches mixer state directly,
+    // state changes are posted to a lock-free commands queue the mixer drains at the start of every callback,
+    // that way the mixing thread never waits on the program thread and stays real-time
+    // NOTE: Offline device is mixed on program thread, commands are applied when posted
+#if !defined(AUDIO_MIXER_ON_MAIN_THREAD)
+    ma_spinlock_lock(&AUDIO.Command.lock);
+    AUDIO.Command.isMixerRunning = !AUDIO.System.isOffline;
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+#endif
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
-    result = ma_device_start(&AUDIO.System.device);
+    // NOTE: Offline device is never started, RenderAudioFrames() calls the mixing callback
+    if (!AUDIO.System.isOffline) result = ma_device_start(&AUDIO.System.device);
     if (result != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to start playback device");
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
+
+        ma_spinlock_lock(&AUDIO.Command.lock);
+        ProcessAudioCommands();
+        AUDIO.Command.isMixerRunning = false;
+        ma_spinlock_unlock(&AUDIO.Command.lock);
+
+        for (int i = 0; i < AUDIO.Voice.count; i++) UnloadAudioBuffer(AUDIO.Voice.voices[i]);
+        RL_FREE(AUDIO.Voice.voices);
+        AUDIO.Voice.voices = NULL;
+        AUDIO.Voice.count = 0;
         return;
     }
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Music streams are decoded ahead of the mixer on a separate thread,
+    // that way a long program frame (i.e. loading assets) does not starve them
+    // NOTE: Offline device refills music streams before mixing instead, output must not depend on timing
+    if (!AUDIO.System.isOffline)
+    {
+        if (ma_mutex_init(&AUDIO.Music.lock) == MA_SUCCESS)
+        {
+            ma_atomic_store_32(&AUDIO.Music.quit, MA_FALSE);
+
+            if (ma_thread_create(&AUDIO.Music.thread, ma_thread_priority_default, 0, MusicDecoderThread, NULL, NULL) == MA_SUCCESS) AUDIO.Music.isThreadRunning = true;
+            else ma_mutex_uninit(&AUDIO.Music.lock);
+        }
+
+        if (!AUDIO.Music.isThreadRunning) TRACELOG(LOG_WARNING, "AUDIO: Failed to start music decoder thread, music streams require UpdateMusicStream()");
+    }
+#endif
+
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio | %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
@@ -526,20 +754,192 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+        if (AUDIO.System.isOffline)
+        {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+            if ((AUDIO.Offline.fileName != NULL) && (AUDIO.Offline.frameCount > 0))
+            {
+                Wave wave = { 0 };
+                wave.frameCount = AUDIO.Offline.frameCount;
+                wave.sampleRate = AUDIO.System.device.sampleRate;
+                wave.sampleSize = 32;
+                wave.channels = AUDIO.System.device.playback.channels;
+                wave.data = AUDIO.Offline.frames;
+
+                ExportWave(wave, AUDIO.Offline.fileName);
+            }
+#endif
+            RL_FREE(AUDIO.Offline.frames);
+            RL_FREE(AUDIO.Offline.fileName);
+            AUDIO.Offline.frames = NULL;
+            AUDIO.Offline.fileName = NULL;
+            AUDIO.Offline.frameCount = 0;
+            AUDIO.Offline.capacity = 0;
+            AUDIO.System.isOffline = false;
+        }
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        if (AUDIO.Music.isThreadRunning)
+        {
+            ma_atomic_store_32(&AUDIO.Music.quit, MA_TRUE);
+            ma_thread_wait(&AUDIO.Music.thread);
+            ma_mutex_uninit(&AUDIO.Music.lock);
+            AUDIO.Music.isThreadRunning = false;
+        }
+#endif
+
+        // Release decoders of music streams not unloaded yet, decoder thread is stopped
+        // NOTE: Stream buffer and decoding context are owned by the music, UnloadMusicStream() frees them
+        while (AUDIO.Music.first != NULL)
+        {
+            rMusicDecoder *decoder = AUDIO.Music.first;
+            AUDIO.Music.first = decoder->next;
+            RL_FREE(decoder);
+        }
+
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        // Mixing thread is stopped, apply pending commands here,
+        // from now on commands are applied when posted
+        ma_spinlock_lock(&AUDIO.Command.lock);
+        ProcessAudioCommands();
+        AUDIO.Command.isMixerRunning = false;
+        ma_spinlock_unlock(&AUDIO.Command.lock);
+
+        // Unload sounds voice pool, voices data is owned by the sounds
+        for (int i = 0; i < AUDIO.Voice.count; i++)
+        {
+            AUDIO.Voice.voices[i]->data = NULL;
+            UnloadAudioBuffer(AUDIO.Voice.voices[i]);
+        }
+
+        RL_FREE(AUDIO.Voice.voices);
+        AUDIO.Voice.voices = NULL;
+        AUDIO.Voice.count = 0;
+
         AUDIO.System.isReady = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
 
+        RL_FREE(AUDIO.SoundCache.directory);
+        AUDIO.SoundCache.directory = NULL;
+
         TRACELOG(LOG_INFO, "AUDIO: Device closed successfully");
     }
     else TRACELOG(LOG_WARNING, "AUDIO: Device could not be closed, not currently initialized");
 }
 
+// Initialize offline audio device, no audio hardware used, mixing happens on RenderAudioFrames() calls
+// NOTE: Rendered frames are kept in memory and saved to a WAV file on device close if fileName is provided
+void InitAudioDeviceOffline(int sampleRate, const char *fileName)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Offline device could not be initialized, device already initialized");
+        return;
+    }
+
+    AUDIO.System.isOffline = true;
+    AUDIO.Offline.sampleRate = (sampleRate > 0)? (unsigned int)sampleRate : 0;
+
+    InitAudioDevice();
+
+    if (!AUDIO.System.isReady)
+    {
+        AUDIO.System.isOffline = false;
+        return;
+    }
+
+    if (fileName != NULL)
+    {
+        AUDIO.Offline.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(AUDIO.Offline.fileName, fileName);
+    }
+
+    TRACELOG(LOG_INFO, "AUDIO: Offline device initialized, frames rendered on request");
+}
+
+// Mix frames on offline audio device
+// NOTE: Music streams are refilled before every mixing period, output only depends on the calls sequence
+void RenderAudioFrames(int frameCount)
+{
+    if (!AUDIO.System.isReady || !AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Frames can only be rendered on offline audio device");
+        return;
+    }
+
+    if (frameCount <= 0) return;
+
+    ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if ((AUDIO.Offline.frameCount + frameCount) > AUDIO.Offline.capacity)
+    {
+        unsigned int capacity = (AUDIO.Offline.capacity > 0)? AUDIO.Offline.capacity : AUDIO.System.device.sampleRate;
+        while (capacity < (AUDIO.Offline.frameCount + frameCount)) capacity *= 2;
+
+        float *frames = (float *)RL_REALLOC(AUDIO.Offline.frames, (size_t)capacity*channels*sizeof(float));
+
+        if (frames == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for offline rendered frames");
+            return;
+        }
+
+        AUDIO.Offline.frames = frames;
+        AUDIO.Offline.capacity = capacity;
+    }
+
+    // Mix in device periods, same as the device data callback would be called
+    ma_uint32 periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    if (periodSize == 0) periodSize = AUDIO.System.device.sampleRate/100;
+
+    float masterVolume = GetMasterVolume();
+    ma_uint32 framesRendered = 0;
+
+    while (framesRendered < (ma_uint32)frameCount)
+    {
+        ma_uint32 framesToRender = (ma_uint32)frameCount - framesRendered;
+        if (framesToRender > periodSize) framesToRender = periodSize;
+
+        for (rMusicDecoder *decoder = AUDIO.Music.first; decoder != NULL; decoder = decoder->next)
+        {
+            if (decoder->music.stream.buffer->playing) UpdateMusicDecoder(decoder);
+        }
+
+        float *framesOut = AUDIO.Offline.frames + (size_t)AUDIO.Offline.frameCount*channels;
+
+        OnSendAudioDataToDevice(&AUDIO.System.device, framesOut, NULL, framesToRender);
+
+        if (masterVolume != 1.0f) ma_apply_volume_factor_pcm_frames(framesOut, framesToRender, ma_format_f32, channels, masterVolume);
+
+        AUDIO.Offline.frameCount += framesToRender;
+        framesRendered += framesToRender;
+    }
+}
+
+// Load offline audio device rendered frames as wave (copy)
+Wave LoadAudioDeviceWave(void)
+{
+    Wave wave = { 0 };
+
+    if (AUDIO.System.isOffline && (AUDIO.Offline.frameCount > 0))
+    {
+        wave.frameCount = AUDIO.Offline.frameCount;
+        wave.sampleRate = AUDIO.System.device.sampleRate;
+        wave.sampleSize = 32;
+        wave.channels = AUDIO.System.device.playback.channels;
+        wave.data = RL_MALLOC((size_t)wave.frameCount*wave.channels*sizeof(float));
+
+        if (wave.data != NULL) memcpy(wave.data, AUDIO.Offline.frames, (size_t)wave.frameCount*wave.channels*sizeof(float));
+        else wave = (Wave){ 0 };
+    }
+
+    return wave;
+}
+
 // Check if device has been initialized successfully
 bool IsAudioDeviceReady(void)
 {
@@ -594,12 +994,13 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
+    audioBuffer->requestedVolume = 1.0f;
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
-    audioBuffer->playing = false;
-    audioBuffer->paused = false;
+    audioBuffer->playing = MA_FALSE;
+    audioBuffer->paused = MA_FALSE;
     audioBuffer->looping = false;
 
     audioBuffer->usage = usage;
@@ -608,8 +1009,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->isSubBufferProcessed[0] = MA_TRUE;
+    audioBuffer->isSubBufferProcessed[1] = MA_TRUE;
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -630,12 +1031,17 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 }
 
 // Check if an audio buffer is playing from a program state without lock
+// NOTE: While state commands are pending the state requested by the program is returned
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        if (IsAudioCommandPending(buffer->lastCommand)) result = (buffer->requestedPlaying && !buffer->requestedPaused);
+        else result = (ma_atomic_load_32(&buffer->playing) && !ma_atomic_load_32(&buffer->paused));
+    }
+
     return result;
 }
 
@@ -644,44 +1050,25 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PostAudioBufferState(buffer, AUDIO_COMMAND_PLAY);
 }
 
 // Stop an audio buffer from a program state without lock
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL) PostAudioBufferState(buffer, AUDIO_COMMAND_STOP);
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PostAudioBufferState(buffer, AUDIO_COMMAND_PAUSE);
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PostAudioBufferState(buffer, AUDIO_COMMAND_RESUME);
 }
 
 // Set volume for an audio buffer
@@ -689,9 +1076,10 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        buffer->requestedVolume = volume;
+
+        AudioCommand command = { .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume };
+        PostAudioCommand(command);
     }
 }
 
@@ -700,16 +1088,8 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch };
+        PostAudioCommand(command);
     }
 }
 
@@ -721,44 +1101,25 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan };
+        PostAudioCommand(command);
     }
 }
 
 // Track audio buffer to linked list next position
+// NOTE: Buffer must be fully initialized, mixer could start reading it right away
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_TRACK, .buffer = buffer };
+    PostAudioCommand(command);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits for the mixer to release the buffer, it can be freed after this call
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer };
+    WaitAudioCommands(PostAudioCommand(command));
 }
 
 //----------------------------------------------------------------------------------
@@ -908,14 +1269,29 @@ bool IsWaveValid(Wave wave)
 
 // Load sound from file
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
+// NOTE: Sounds loaded from the same file share converted data, UpdateSound() copies it before writing
 Sound LoadSound(const char *fileName)
 {
-    Wave wave = LoadWave(fileName);
+    rSoundCacheEntry *entry = GetSoundCacheEntry(fileName);
+
+    if (entry != NULL) return LoadSoundFromCache(entry);
+
+    // Converted data could be available on disk, no decoding or resampling required then
+    Wave wave = LoadSoundDiskCache(fileName);
+    bool isDiskCached = (wave.data != NULL);
+
+    if (!isDiskCached) wave = LoadWave(fileName);
 
     Sound sound = LoadSoundFromWave(wave);
 
     UnloadWave(wave);       // Sound is loaded, we can unload wave
 
+    if (sound.stream.buffer != NULL)
+    {
+        if (!isDiskCached) SaveSoundDiskCache(fileName, sound);
+        AddSoundCacheEntry(fileName, sound);
+    }
+
     return sound;
 }
 
@@ -979,7 +1355,9 @@ Sound LoadSoundAlias(Sound source)
         }
 
         audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
-        audioBuffer->volume = source.stream.buffer->volume;
+        audioBuffer->volume = source.stream.buffer->requestedVolume;
+        audioBuffer->requestedVolume = source.stream.buffer->requestedVolume;
+        audioBuffer->priority = source.stream.buffer->priority;
         audioBuffer->data = source.stream.buffer->data;
 
         sound.frameCount = source.frameCount;
@@ -1017,15 +1395,43 @@ void UnloadWave(Wave wave)
 // Unload sound
 void UnloadSound(Sound sound)
 {
-    UnloadAudioBuffer(sound.stream.buffer);
+    ReleaseAudioVoices(sound.stream.buffer);
+
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->cache != NULL))
+    {
+        // Sample data is owned by the cache entry, released once no sound uses it
+        rSoundCacheEntry *entry = sound.stream.buffer->cache;
+
+        UntrackAudioBuffer(sound.stream.buffer);
+        ma_data_converter_uninit(&sound.stream.buffer->converter, NULL);
+        RL_FREE(sound.stream.buffer);
+
+        ReleaseSoundCacheEntry(entry);
+    }
+    else UnloadAudioBuffer(sound.stream.buffer);
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
 
+// Set directory to keep converted sounds (QOA), later loads skip decoding and resampling, NULL to disable
+// NOTE: Cached files are used while newer than the sound file, QOA is lossy
+void SetSoundCacheDirectory(const char *dirPath)
+{
+    RL_FREE(AUDIO.SoundCache.directory);
+    AUDIO.SoundCache.directory = NULL;
+
+    if (dirPath != NULL)
+    {
+        AUDIO.SoundCache.directory = (char *)RL_MALLOC(strlen(dirPath) + 1);
+        strcpy(AUDIO.SoundCache.directory, dirPath);
+    }
+}
+
 void UnloadSoundAlias(Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
+        ReleaseAudioVoices(alias.stream.buffer);
         UntrackAudioBuffer(alias.stream.buffer);
         ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         RL_FREE(alias.stream.buffer);
@@ -1037,7 +1443,13 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
-        StopAudioBuffer(sound.stream.buffer);
+        StopSound(sound);
+
+        // Make sure mixer is not reading the data anymore
+        WaitAudioCommands(AUDIO.Command.writeIndex);
+
+        // Cached data is shared with other sounds and later loads of the same file, sound gets its own data
+        if ((sound.stream.buffer->cache != NULL) && !DetachSoundCacheEntry(sound.stream.buffer)) return;
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1169,27 +1581,34 @@ bool ExportWaveAsCode(Wave wave, const char *fileName)
 }
 
 // Play a sound
+// NOTE: Every play takes a voice from the pool, a sound can be played multiple times at once
 void PlaySound(Sound sound)
 {
-    PlayAudioBuffer(sound.stream.buffer);
+    if (sound.stream.buffer == NULL) return;
+
+    if (AUDIO.Voice.count > 0) PlayAudioVoice(sound.stream.buffer, NULL);
+    else PlayAudioBuffer(sound.stream.buffer);
 }
 
 // Pause a sound
 void PauseSound(Sound sound)
 {
     PauseAudioBuffer(sound.stream.buffer);
+    SetAudioVoicesState(sound.stream.buffer, AUDIO_COMMAND_PAUSE);
 }
 
 // Resume a paused sound
 void ResumeSound(Sound sound)
 {
     ResumeAudioBuffer(sound.stream.buffer);
+    SetAudioVoicesState(sound.stream.buffer, AUDIO_COMMAND_RESUME);
 }
 
 // Stop reproducing a sound
 void StopSound(Sound sound)
 {
     StopAudioBuffer(sound.stream.buffer);
+    SetAudioVoicesState(sound.stream.buffer, AUDIO_COMMAND_STOP);
 }
 
 // Check if a sound is playing
@@ -1198,26 +1617,134 @@ bool IsSoundPlaying(Sound sound)
     bool result = false;
 
     if (IsAudioBufferPlaying(sound.stream.buffer)) result = true;
+    else if (sound.stream.buffer != NULL)
+    {
+        for (int i = 0; i < AUDIO.Voice.count; i++)
+        {
+            AudioBuffer *voice = AUDIO.Voice.voices[i];
+
+            if ((voice->source == sound.stream.buffer) && IsAudioBufferPlaying(voice))
+            {
+                result = true;
+                break;
+            }
+        }
+    }
 
     return result;
 }
 
 // Set volume for a sound
+// NOTE: Voices already playing the sound are also updated
 void SetSoundVolume(Sound sound, float volume)
 {
     SetAudioBufferVolume(sound.stream.buffer, volume);
+    SetAudioVoicesValue(sound.stream.buffer, AUDIO_COMMAND_VOLUME, volume);
 }
 
 // Set pitch for a sound
 void SetSoundPitch(Sound sound, float pitch)
 {
     SetAudioBufferPitch(sound.stream.buffer, pitch);
+    SetAudioVoicesValue(sound.stream.buffer, AUDIO_COMMAND_PITCH, pitch);
 }
 
 // Set pan for a sound
 void SetSoundPan(Sound sound, float pan)
 {
     SetAudioBufferPan(sound.stream.buffer, pan);
+    SetAudioVoicesValue(sound.stream.buffer, AUDIO_COMMAND_PAN, pan);
+}
+
+// Set priority for a sound, when all voices are in use the lowest priority voice is stolen
+// NOTE: Plays are rejected if all voices in use have a higher priority than the sound
+void SetSoundPriority(Sound sound, int priority)
+{
+    if (sound.stream.buffer != NULL) sound.stream.buffer->priority = priority;
+}
+
+// Set listener position and orientation for positional sounds
+// NOTE: Usually set every frame from the camera, forward is camera target minus camera position
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up)
+{
+    // Right direction: cross(forward, up), normalized
+    float right[3] = { forward.y*up.z - forward.z*up.y, forward.z*up.x - forward.x*up.z, forward.x*up.y - forward.y*up.x };
+    float length = sqrtf(right[0]*right[0] + right[1]*right[1] + right[2]*right[2]);
+
+    if (length > 0.0f)
+    {
+        for (int i = 0; i < 3; i++) ma_atomic_store_explicit_f32(&AUDIO.Listener.right[i], right[i]/length, ma_atomic_memory_order_relaxed);
+    }
+
+    ma_atomic_store_explicit_f32(&AUDIO.Listener.position[0], position.x, ma_atomic_memory_order_relaxed);
+    ma_atomic_store_explicit_f32(&AUDIO.Listener.position[1], position.y, ma_atomic_memory_order_relaxed);
+    ma_atomic_store_explicit_f32(&AUDIO.Listener.position[2], position.z, ma_atomic_memory_order_relaxed);
+}
+
+// Play a sound at a world position, pan and attenuation are computed by the mixer from the listener
+// NOTE: Returned voice id is only valid while the voice plays this sound, it is ignored after that
+int PlaySoundAt(Sound sound, Vector3 position)
+{
+    int id = -1;
+
+    if ((sound.stream.buffer != NULL) && (AUDIO.Voice.count > 0))
+    {
+        AudioBuffer *voice = PlayAudioVoice(sound.stream.buffer, &position);
+
+        for (int i = 0; (voice != NULL) && (i < AUDIO.Voice.count); i++)
+        {
+            // Voice id: voice index and play order bits to detect reused voices
+            if (AUDIO.Voice.voices[i] == voice) id = (int)(((voice->playOrder & 0x7fff) << 16) | (unsigned int)i);
+        }
+    }
+
+    return id;
+}
+
+// Set world position of a positional sound voice
+// NOTE: No command is posted, the mixer reads voices positions on every mix, it is cheap to call per frame
+void SetSoundVoicePosition(int voice, Vector3 position)
+{
+    int index = voice & 0xffff;
+
+    if ((voice < 0) || (index >= AUDIO.Voice.count)) return;
+
+    AudioBuffer *buffer = AUDIO.Voice.voices[index];
+
+    if ((buffer->source != NULL) && ((int)(buffer->playOrder & 0x7fff) == (voice >> 16)))
+    {
+        ma_atomic_store_explicit_f32(&buffer->position[0], position.x, ma_atomic_memory_order_relaxed);
+        ma_atomic_store_explicit_f32(&buffer->position[1], position.y, ma_atomic_memory_order_relaxed);
+        ma_atomic_store_explicit_f32(&buffer->position[2], position.z, ma_atomic_memory_order_relaxed);
+    }
+}
+
+// Set positional sound attenuation distances
+// NOTE: Volume starts decreasing at minDistance, voices beyond maxDistance are not mixed
+void SetSoundDistance(Sound sound, float minDistance, float maxDistance)
+{
+    if ((sound.stream.buffer != NULL) && (minDistance > 0.0f) && (maxDistance > minDistance))
+    {
+        sound.stream.buffer->distance[0] = minDistance;
+        sound.stream.buffer->distance[1] = maxDistance;
+    }
+}
+
+// Get sounds voice pool usage stats
+AudioVoiceStats GetAudioVoiceStats(void)
+{
+    AudioVoiceStats stats = { 0 };
+
+    stats.voiceCount = AUDIO.Voice.count;
+    stats.steals = AUDIO.Voice.steals;
+    stats.rejectedPlays = AUDIO.Voice.rejectedPlays;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        if (IsAudioVoiceInUse(AUDIO.Voice.voices[i])) stats.voicesInUse++;
+    }
+
+    return stats;
 }
 
 // Convert wave data to desired format
@@ -1342,7 +1869,7 @@ Music LoadMusicStream(const char *fileName)
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadMusicAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1366,7 +1893,7 @@ Music LoadMusicStream(const char *fileName)
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadMusicAudioStream(info.sample_rate, 16, info.channels);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1389,7 +1916,7 @@ Music LoadMusicStream(const char *fileName)
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadMusicAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1411,7 +1938,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxData = ctxQoa;
             // NOTE: We are loading samples are 32bit float normalized data, so,
             // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream = LoadMusicAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1430,7 +1957,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxData = ctxFlac;
             int sampleSize = ctxFlac->bitsPerSample;
             if (ctxFlac->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
+            music.stream = LoadMusicAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1458,7 +1985,7 @@ Music LoadMusicStream(const char *fileName)
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1482,7 +2009,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxType = MUSIC_MODULE_MOD;
             music.ctxData = ctxMod;
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1508,6 +2035,8 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        AttachMusicDecoder(music);
     }
 
     return music;
@@ -1535,7 +2064,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadMusicAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1559,7 +2088,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadMusicAudioStream(info.sample_rate, 16, info.channels);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1582,7 +2111,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadMusicAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1609,7 +2138,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxQoa;
             // NOTE: We are loading samples are 32bit float normalized data, so,
             // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream = LoadMusicAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1628,7 +2157,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxFlac;
             int sampleSize = ctxFlac->bitsPerSample;
             if (ctxFlac->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
+            music.stream = LoadMusicAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1655,7 +2184,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, 2);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, bits, 2);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1695,7 +2224,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxMod;
 
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, 2);
+            music.stream = LoadMusicAudioStream(AUDIO.System.device.sampleRate, 16, 2);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1721,6 +2250,8 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        AttachMusicDecoder(music);
     }
 
     return music;
@@ -1739,6 +2270,7 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    DetachMusicDecoder(music);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1771,7 +2303,22 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+    LockMusicDecoder();
+
+    rMusicDecoder *decoder = GetMusicDecoder(music);
+
+    if (decoder != NULL)
+    {
+        ma_atomic_store_32(&decoder->looping, music.looping);
+        ma_atomic_store_32(&music.stream.buffer->isStreamEnding, MA_FALSE);
+
+        // Fill stream buffers before playing, mixer should not wait for the decoder thread on start
+        UpdateMusicDecoder(decoder);
+    }
+
     PlayAudioStream(music.stream);
+
+    UnlockMusicDecoder();
 }
 
 // Pause music playing
@@ -1789,33 +2336,21 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+    LockMusicDecoder();
+
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+    // Wait for the mixer to reset the stream buffers, they must be refilled from the start
+    if (music.stream.buffer != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        WaitAudioCommands(music.stream.buffer->lastCommand);
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, 0);
+        ma_atomic_store_32(&music.stream.buffer->isStreamEnding, MA_FALSE);
     }
+
+    RewindMusicStream(music);
+
+    UnlockMusicDecoder();
 }
 
 // Seek music to a certain position (in seconds)
@@ -1826,6 +2361,8 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    LockMusicDecoder();
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1853,170 +2390,30 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_store_32(&music.stream.buffer->framesProcessed, positionInFrames);
+    ma_atomic_store_32(&music.stream.buffer->isStreamEnding, MA_FALSE);
+
+    UnlockMusicDecoder();
 }
 
 // Update (re-fill) music buffers if data already processed
+// NOTE: Music streams are refilled by the decoder thread if available, only looping state is updated here
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Decoders list is only modified by program thread, no lock required to look it up
+    rMusicDecoder *decoder = GetMusicDecoder(music);
 
-    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
-
-    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
-    int frameSize = music.stream.channels*music.stream.sampleSize/8;
-    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
-
-    if (AUDIO.System.pcmBufferSize < pcmSize)
-    {
-        RL_FREE(AUDIO.System.pcmBuffer);
-        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
-        AUDIO.System.pcmBufferSize = pcmSize;
-    }
-
-    // Check both sub-buffers to check if they require refilling
-    for (int i = 0; i < 2; i++)
+    if (decoder != NULL)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
-
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
-        unsigned int framesToStream = 0;                 // Total frames to be streamed
-
-        if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
-        else framesToStream = framesLeft;
-
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
-
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+        ma_atomic_store_32(&decoder->looping, music.looping);
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
-
-        if (framesLeft <= subBufferSizeInFrames)
-        {
-            if (!music.looping)
-            {
-                ma_mutex_unlock(&AUDIO.System.lock);
-                // Streaming is ending, we filled latest frames from input
-                StopMusicStream(music);
-                return;
-            }
-        }
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        if (AUDIO.Music.isThreadRunning) return;
+#endif
+        UpdateMusicDecoder(decoder);
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Check if any music is playing
@@ -2070,23 +2467,62 @@ float GetMusicTimePlayed(Music music)
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+            int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
     return secondsPlayed;
 }
 
+// Get music stream decoding stats
+MusicStreamStats GetMusicStreamStats(Music music)
+{
+    MusicStreamStats stats = { 0 };
+
+    if (music.stream.buffer == NULL) return stats;
+
+    stats.underruns = ma_atomic_load_32(&music.stream.buffer->underruns);
+
+    LockMusicDecoder();
+
+    rMusicDecoder *decoder = GetMusicDecoder(music);
+
+    if ((decoder != NULL) && (decoder->decodeCount > 0))
+    {
+        stats.decodeTime = (float)(decoder->decodeTime/decoder->decodeCount);
+        stats.decodeTimeMax = (float)decoder->decodeTimeMax;
+    }
+
+    UnlockMusicDecoder();
+
+    // Decoded frames waiting to be mixed: filled sub-buffers minus frames already read from the current one
+    int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
+    int currentSubBuffer = (int)ma_atomic_load_32(&music.stream.buffer->frameCursorPos)/subBufferSize;
+    int framesBuffered = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) framesBuffered += subBufferSize;
+    }
+
+    if ((currentSubBuffer < 2) && !ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[currentSubBuffer]))
+    {
+        framesBuffered -= (int)ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
+    }
+
+    stats.bufferedTime = (float)framesBuffered/music.stream.sampleRate;
+
+    return stats;
+}
+
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -2141,9 +2577,55 @@ void UnloadAudioStream(AudioStream stream)
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer != NULL)
+    {
+        ma_bool32 isSubBufferProcessed[2] = { 0 };
+        isSubBufferProcessed[0] = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]);
+        isSubBufferProcessed[1] = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
+        {
+            ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
+            {
+                // Both buffers are available for updating
+                // Update the one the mixer cursor is waiting on, cursor is owned by the mixing thread
+                subBufferToUpdate = (ma_atomic_load_32(&stream.buffer->frameCursorPos)/subBufferSizeInFrames)%2;
+            }
+            else
+            {
+                // Just update whichever sub-buffer is processed
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
+            }
+
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Total frames processed in buffer is always the complete size, filled with 0 if required
+            ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                // Release the sub-buffer data to the mixing thread
+                ma_atomic_store_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], MA_FALSE);
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
 }
 
 // Check if any audio stream buffers requires refill
@@ -2151,11 +2633,7 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
-    return result;
+    return (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]));
 }
 
 // Play audio stream
@@ -2217,63 +2695,23 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
     if (stream.buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback };
+        PostAudioCommand(command);
     }
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
-// The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
+// The new processor must be added at the end. Processors lists are immutable once sent to the mixer,
+// a new list is built with the processor added and replaces the current one
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
-    processor->process = process;
-
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer != NULL) SetAudioProcessors(stream.buffer, AddAudioProcessor(stream.buffer->processor, process));
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer != NULL) SetAudioProcessors(stream.buffer, RemoveAudioProcessor(stream.buffer->processor, process));
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2281,52 +2719,13 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
-    processor->process = process;
-
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SetAudioProcessors(NULL, AddAudioProcessor(AUDIO.mixedProcessor, process));
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SetAudioProcessors(NULL, RemoveAudioProcessor(AUDIO.mixedProcessor, process));
 }
 
 
@@ -2347,7 +2746,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
@@ -2359,9 +2758,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    ma_bool32 isSubBufferProcessed[2] = { 0 };
+    isSubBufferProcessed[0] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2400,21 +2799,21 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
-            isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], MA_TRUE);
+            isSubBufferProcessed[currentSubBufferIndex] = MA_TRUE;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
 
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2429,7 +2828,16 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         // For static buffers we can fill the remaining frames with silence for safety, but we don't want
         // to report those frames as "read". The reason for this is that the caller uses the return value
         // to know whether a non-looping sound has finished playback
-        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) framesRead += totalFramesRemaining;
+        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC)
+        {
+            // Stream ran out of data, music played its last frames or sub-buffers were not refilled in time
+            if (ma_atomic_load_32(&audioBuffer->isStreamEnding) &&
+                ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]) &&
+                ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1])) StopAudioBufferInMixer(audioBuffer);
+            else ma_atomic_fetch_add_32(&audioBuffer->underruns, 1);
+
+            framesRead += totalFramesRemaining;
+        }
     }
 
     return framesRead;
@@ -2442,7 +2850,7 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    ma_uint8 inputBuffer[4096];     // NOTE: No initialization required, filled by the reader
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2491,81 +2899,75 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Apply state changes posted by the program since last callback
+    // NOTE: No lock is taken here, buffers list and playback state are only modified by this thread
+    ProcessAudioCommands();
     {
+        // Frames for stereo, filled by the data converter before running processors and mixing
+        // NOTE: No initialization required, only the frames read are used
+        float tempBuffer[1024];
+        const ma_uint32 tempBufferFrameCap = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
             if (!audioBuffer->playing || audioBuffer->paused) continue;
 
+            // Positional voices out of range are not mixed, just moved forward to keep them in time
+            if (!UpdateAudioBufferSpatial(audioBuffer))
+            {
+                SkipAudioBufferFrames(audioBuffer, frameCount);
+                continue;
+            }
+
+            // Just read as much data as we can from the stream
             ma_uint32 framesRead = 0;
 
-            while (1)
+            while (framesRead < frameCount)
             {
-                if (framesRead >= frameCount) break;
+                ma_uint32 framesToReadRightNow = frameCount - framesRead;
+                if (framesToReadRightNow > tempBufferFrameCap) framesToReadRightNow = tempBufferFrameCap;
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
-
-                while (framesToRead > 0)
+                ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+                if (framesJustRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = tempBuffer;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    // Apply processors chain if defined
+                    rAudioProcessor *processor = audioBuffer->processor;
+                    while (processor)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        processor->process(framesIn, framesJustRead);
+                        processor = processor->next;
                     }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+                    MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+                    framesRead += framesJustRead;
+                }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                if (!audioBuffer->playing) break;
 
-                    if (!audioBuffer->playing)
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        StopAudioBufferInMixer(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+
+                        // If for some reason we weren't able to read any frame we'll need to break from the loop
+                        // Not doing this could theoretically put us into an infinite loop
+                        if (framesJustRead == 0) break;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
         }
     }
@@ -2576,130 +2978,1071 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor->process(pFramesOut, frameCount);
         processor = processor->next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Gains are ramped from the ones used on previous mix to the current volume/pan, avoiding zipper noise on changes
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
-    const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
+    float gains[2] = { 0 };
+    GetAudioBufferGains(buffer, gains);
+
     if (channels == 2)  // We consider panning
     {
-        const float left = buffer->pan;
-        const float right = 1.0f - left;
-
-        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
-
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
-
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
-
-            frameOut += 2;
-            frameIn += 2;
-        }
+        MixAudioFramesStereo(framesOut, framesIn, frameCount, buffer->gains, gains);
     }
     else  // We do not consider panning
     {
+        const float gainStep = (gains[0] - buffer->gains[0])/(float)frameCount;
+
         for (ma_uint32 frame = 0; frame < frameCount; frame++)
         {
+            const float gain = buffer->gains[0] + gainStep*(float)(frame + 1);
+
             for (ma_uint32 c = 0; c < channels; c++)
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
-
                 // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                framesOut[frame*channels + c] += (framesIn[frame*channels + c]*gain);
             }
         }
     }
+
+    buffer->gains[0] = gains[0];
+    buffer->gains[1] = gains[1];
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Mix stereo frames, gains ramp linearly from startGains to reach endGains on the last frame
+// NOTE: Frames are processed in blocks of 4 stereo frames (8 samples), remaining frames are mixed one by one
+static void MixAudioFramesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *startGains, const float *endGains)
 {
-    bool result = false;
+    const float stepLeft = (endGains[0] - startGains[0])/(float)frameCount;
+    const float stepRight = (endGains[1] - startGains[1])/(float)frameCount;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    ma_uint32 frame = 0;
 
-    return result;
+#if defined(AUDIO_MIXER_SIMD_AVX)
+    __m256 gains = _mm256_setr_ps(startGains[0] + stepLeft, startGains[1] + stepRight, startGains[0] + 2*stepLeft, startGains[1] + 2*stepRight,
+                                  startGains[0] + 3*stepLeft, startGains[1] + 3*stepRight, startGains[0] + 4*stepLeft, startGains[1] + 4*stepRight);
+    const __m256 gainsStep = _mm256_setr_ps(4*stepLeft, 4*stepRight, 4*stepLeft, 4*stepRight, 4*stepLeft, 4*stepRight, 4*stepLeft, 4*stepRight);
+
+    for (; (frame + 4) <= frameCount; frame += 4)
+    {
+        __m256 out = _mm256_loadu_ps(framesOut + frame*2);
+        out = _mm256_add_ps(out, _mm256_mul_ps(_mm256_loadu_ps(framesIn + frame*2), gains));
+        _mm256_storeu_ps(framesOut + frame*2, out);
+
+        gains = _mm256_add_ps(gains, gainsStep);
+    }
+#elif defined(AUDIO_MIXER_SIMD_SSE)
+    __m128 gains0 = _mm_setr_ps(startGains[0] + stepLeft, startGains[1] + stepRight, startGains[0] + 2*stepLeft, startGains[1] + 2*stepRight);
+    __m128 gains1 = _mm_setr_ps(startGains[0] + 3*stepLeft, startGains[1] + 3*stepRight, startGains[0] + 4*stepLeft, startGains[1] + 4*stepRight);
+    const __m128 gainsStep = _mm_setr_ps(4*stepLeft, 4*stepRight, 4*stepLeft, 4*stepRight);
+
+    for (; (frame + 4) <= frameCount; frame += 4)
+    {
+        __m128 out0 = _mm_loadu_ps(framesOut + frame*2);
+        __m128 out1 = _mm_loadu_ps(framesOut + frame*2 + 4);
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_loadu_ps(framesIn + frame*2), gains0));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_loadu_ps(framesIn + frame*2 + 4), gains1));
+        _mm_storeu_ps(framesOut + frame*2, out0);
+        _mm_storeu_ps(framesOut + frame*2 + 4, out1);
+
+        gains0 = _mm_add_ps(gains0, gainsStep);
+        gains1 = _mm_add_ps(gains1, gainsStep);
+    }
+#elif defined(AUDIO_MIXER_SIMD_NEON)
+    const float gainsInit[8] = { startGains[0] + stepLeft, startGains[1] + stepRight, startGains[0] + 2*stepLeft, startGains[1] + 2*stepRight,
+                                 startGains[0] + 3*stepLeft, startGains[1] + 3*stepRight, startGains[0] + 4*stepLeft, startGains[1] + 4*stepRight };
+    float32x4_t gains0 = vld1q_f32(gainsInit);
+    float32x4_t gains1 = vld1q_f32(gainsInit + 4);
+    const float gainsStepInit[4] = { 4*stepLeft, 4*stepRight, 4*stepLeft, 4*stepRight };
+    const float32x4_t gainsStep = vld1q_f32(gainsStepInit);
+
+    for (; (frame + 4) <= frameCount; frame += 4)
+    {
+        float32x4_t out0 = vld1q_f32(framesOut + frame*2);
+        float32x4_t out1 = vld1q_f32(framesOut + frame*2 + 4);
+        out0 = vmlaq_f32(out0, vld1q_f32(framesIn + frame*2), gains0);
+        out1 = vmlaq_f32(out1, vld1q_f32(framesIn + frame*2 + 4), gains1);
+        vst1q_f32(framesOut + frame*2, out0);
+        vst1q_f32(framesOut + frame*2 + 4, out1);
+
+        gains0 = vaddq_f32(gains0, gainsStep);
+        gains1 = vaddq_f32(gains1, gainsStep);
+    }
+#endif
+
+    for (; frame < frameCount; frame++)
+    {
+        framesOut[frame*2] += framesIn[frame*2]*(startGains[0] + stepLeft*(float)(frame + 1));
+        framesOut[frame*2 + 1] += framesIn[frame*2 + 1]*(startGains[1] + stepRight*(float)(frame + 1));
+    }
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Get channel gains for an audio buffer current volume and pan
+// NOTE: Positional buffers use the pan and attenuation computed from the listener
+static void GetAudioBufferGains(const AudioBuffer *buffer, float *gains)
 {
-    if (buffer != NULL)
+    const bool positional = (buffer->distance[1] > 0.0f);
+    const float volume = positional? buffer->volume*buffer->spatialGain : buffer->volume;
+    const float left = positional? buffer->spatialPan : buffer->pan;
+    const float right = 1.0f - left;
+
+    // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
+    gains[0] = volume*0.5f*left*(3.0f - left*left);
+    gains[1] = volume*0.5f*right*(3.0f - right*right);
+
+    // Without panning both gains are just the volume
+    if (AUDIO.System.device.playback.channels != 2) gains[0] = gains[1] = volume;
+}
+
+// Compute positional buffer attenuation and pan relative to the listener, called from the mixing thread
+// Returns false if the buffer is out of audible range and should not be mixed
+static bool UpdateAudioBufferSpatial(AudioBuffer *buffer)
+{
+    if (buffer->distance[1] <= 0.0f) return true;   // Not a positional buffer
+
+    float delta[3] = { 0 };
+    float distance = 0.0f;
+    float side = 0.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        delta[i] = ma_atomic_load_explicit_f32(&buffer->position[i], ma_atomic_memory_order_relaxed) -
+                   ma_atomic_load_explicit_f32(&AUDIO.Listener.position[i], ma_atomic_memory_order_relaxed);
+        distance += delta[i]*delta[i];
+        side += delta[i]*ma_atomic_load_explicit_f32(&AUDIO.Listener.right[i], ma_atomic_memory_order_relaxed);
+    }
+
+    distance = sqrtf(distance);
+
+    if (distance >= buffer->distance[1]) return false;
+
+    // Inverse distance attenuation from min distance, faded out to reach zero at max distance
+    const float minDistance = buffer->distance[0];
+    buffer->spatialGain = minDistance/((distance > minDistance)? distance : minDistance)*(1.0f - distance/buffer->distance[1]);
+
+    // Pan 1.0 is left: sounds on the listener right side move pan towards 0.0
+    buffer->spatialPan = (distance > 0.0f)? 0.5f - 0.5f*side/distance : 0.5f;
+
+    return true;
+}
+
+// Move a culled buffer cursor forward as if its frames were mixed, no conversion or mixing is done
+static void SkipAudioBufferFrames(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint32 cursor = buffer->frameCursorPos + (ma_uint32)((float)frameCount*buffer->pitch);
+
+    if (cursor >= buffer->sizeInFrames)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        if (!buffer->looping || (buffer->sizeInFrames == 0))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            StopAudioBufferInMixer(buffer);
+            return;
         }
+
+        cursor %= buffer->sizeInFrames;
     }
+
+    ma_atomic_store_32(&buffer->frameCursorPos, cursor);
+
+    // Ramp in from silence when getting back into audible range
+    buffer->gains[0] = 0.0f;
+    buffer->gains[1] = 0.0f;
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Post a command to the mixing thread, returns the queue position after the command
+// NOTE: Queue is single-consumer, commands are applied in order at the start of the next mixing callback,
+// program threads posting commands are serialized with a spinlock the mixer never takes
+static ma_uint32 PostAudioCommand(AudioCommand command)
 {
-    if (stream.buffer != NULL)
+    ma_spinlock_lock(&AUDIO.Command.lock);
+
+    ma_uint32 writeIndex = AUDIO.Command.writeIndex;
+
+    if (AUDIO.Command.isMixerRunning)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        // Queue full, wait for the mixer to make room
+        while ((writeIndex - ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_acquire)) >= AUDIO_COMMAND_QUEUE_SIZE)
         {
-            ma_uint32 subBufferToUpdate = 0;
+            if (!ma_device_is_started(&AUDIO.System.device)) ProcessAudioCommands();
+            else ma_sleep(1);
+        }
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
-            }
+        AUDIO.Command.queue[writeIndex%AUDIO_COMMAND_QUEUE_SIZE] = command;
+        ma_atomic_store_explicit_32(&AUDIO.Command.writeIndex, writeIndex + 1, ma_atomic_memory_order_release);
+    }
+    else
+    {
+        // No mixing thread running, apply command right away
+        ProcessAudioCommand(&command);
+        ma_atomic_store_explicit_32(&AUDIO.Command.writeIndex, writeIndex + 1, ma_atomic_memory_order_release);
+        ma_atomic_store_explicit_32(&AUDIO.Command.readIndex, writeIndex + 1, ma_atomic_memory_order_release);
+    }
+
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+
+    return writeIndex + 1;
+}
+
+// Post a playback state command for an audio buffer
+// NOTE: Requested state is kept on program side, IsAudioBufferPlaying() reports it until the mixer catches up
+static void PostAudioBufferState(AudioBuffer *buffer, int type)
+{
+    if (!IsAudioCommandPending(buffer->lastCommand))
+    {
+        buffer->requestedPlaying = ma_atomic_load_32(&buffer->playing);
+        buffer->requestedPaused = ma_atomic_load_32(&buffer->paused);
+    }
+
+    switch (type)
+    {
+        case AUDIO_COMMAND_PLAY: buffer->requestedPlaying = true; buffer->requestedPaused = false; break;
+        case AUDIO_COMMAND_STOP: buffer->requestedPlaying = false; buffer->requestedPaused = false; break;
+        case AUDIO_COMMAND_PAUSE: buffer->requestedPaused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->requestedPaused = false; break;
+        default: break;
+    }
+
+    AudioCommand command = { .type = type, .buffer = buffer };
+    buffer->lastCommand = PostAudioCommand(command);
+}
+
+// Check if commands up to a queue position are still waiting for the mixer
+static bool IsAudioCommandPending(ma_uint32 position)
+{
+    return ((int)(position - ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_acquire)) > 0);
+}
+
+// Wait for the mixer to process commands up to a queue position
+// NOTE: Blocks the program thread for one mixing period at most, only used before freeing or overwriting mixer data
+static void WaitAudioCommands(ma_uint32 position)
+{
+    while (IsAudioCommandPending(position))
+    {
+        // Device stopped by the backend (i.e. device lost), mixing callback is not called anymore
+        if (!ma_device_is_started(&AUDIO.System.device))
+        {
+            ma_spinlock_lock(&AUDIO.Command.lock);
+            ProcessAudioCommands();
+            ma_spinlock_unlock(&AUDIO.Command.lock);
+        }
+        else ma_sleep(1);
+    }
+}
+
+// Apply all posted commands, called by the mixing thread (or program thread if mixer is not running)
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 readIndex = AUDIO.Command.readIndex;
+    ma_uint32 writeIndex = ma_atomic_load_explicit_32(&AUDIO.Command.writeIndex, ma_atomic_memory_order_acquire);
+
+    while (readIndex != writeIndex)
+    {
+        ProcessAudioCommand(&AUDIO.Command.queue[readIndex%AUDIO_COMMAND_QUEUE_SIZE]);
+        readIndex++;
+    }
+
+    ma_atomic_store_explicit_32(&AUDIO.Command.readIndex, readIndex, ma_atomic_memory_order_release);
+}
+
+// Apply one command to mixer state
+static void ProcessAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
             else
             {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
             }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
 
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            buffer->prev = NULL;
+            buffer->next = NULL;
+        } break;
+        case AUDIO_COMMAND_PLAY:
+        {
+            ma_atomic_store_32(&buffer->playing, MA_TRUE);
+            ma_atomic_store_32(&buffer->paused, MA_FALSE);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+
+            // Start at the target gains, ramps are only applied to changes while playing
+            GetAudioBufferGains(buffer, buffer->gains);
+        } break;
+        case AUDIO_COMMAND_PLAY_VOICE:
+        {
+            // Voice takes the sound data and current settings, it could be playing another sound (stolen)
+            AudioBuffer *source = command->source;
+
+            buffer->data = source->data;
+            buffer->sizeInFrames = source->sizeInFrames;
+            buffer->volume = source->volume;
+            buffer->pan = source->pan;
+
+            if (buffer->pitch != source->pitch)
             {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+                ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/source->pitch);
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+                buffer->pitch = source->pitch;
+            }
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+            ma_data_converter_reset(&buffer->converter);
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+            ma_atomic_store_32(&buffer->playing, MA_TRUE);
+            ma_atomic_store_32(&buffer->paused, MA_FALSE);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+            buffer->distance[0] = command->distance[0];
+            buffer->distance[1] = command->distance[1];
+
+            if (UpdateAudioBufferSpatial(buffer)) GetAudioBufferGains(buffer, buffer->gains);
+            else buffer->gains[0] = buffer->gains[1] = 0.0f;
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioBufferInMixer(buffer); break;
+        case AUDIO_COMMAND_PAUSE: ma_atomic_store_32(&buffer->paused, MA_TRUE); break;
+        case AUDIO_COMMAND_RESUME: ma_atomic_store_32(&buffer->paused, MA_FALSE); break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_PROCESSOR:
+        {
+            if (buffer != NULL) buffer->processor = command->processor;
+            else AUDIO.mixedProcessor = command->processor;
+        } break;
+        default: break;
+    }
+}
+
+// Replace processors list of an audio buffer (or mixed output if buffer is NULL)
+// NOTE: Previous list is freed once the mixer does not use it anymore
+static void SetAudioProcessors(AudioBuffer *buffer, rAudioProcessor *processors)
+{
+    rAudioProcessor *previous = (buffer != NULL)? buffer->processor : AUDIO.mixedProcessor;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_PROCESSOR, .buffer = buffer, .processor = processors };
+    WaitAudioCommands(PostAudioCommand(command));
+
+    while (previous != NULL)
+    {
+        rAudioProcessor *next = previous->next;
+        RL_FREE(previous);
+        previous = next;
+    }
+}
+
+// Copy a processors list adding a new processor at the end
+static rAudioProcessor *AddAudioProcessor(const rAudioProcessor *processors, AudioCallback process)
+{
+    rAudioProcessor *first = NULL;
+    rAudioProcessor *last = NULL;
+
+    for (const rAudioProcessor *processor = processors; ; processor = processor->next)
+    {
+        rAudioProcessor *copy = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+        copy->process = (processor != NULL)? processor->process : process;
+        copy->prev = last;
+
+        if (last != NULL) last->next = copy;
+        else first = copy;
+        last = copy;
+
+        if (processor == NULL) break;
+    }
+
+    return first;
+}
+
+// Copy a processors list removing all instances of a processor
+static rAudioProcessor *RemoveAudioProcessor(const rAudioProcessor *processors, AudioCallback process)
+{
+    rAudioProcessor *first = NULL;
+    rAudioProcessor *last = NULL;
+
+    for (const rAudioProcessor *processor = processors; processor != NULL; processor = processor->next)
+    {
+        if (processor->process == process) continue;
+
+        rAudioProcessor *copy = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+        copy->process = processor->process;
+        copy->prev = last;
+
+        if (last != NULL) last->next = copy;
+        else first = copy;
+        last = copy;
+    }
+
+    return first;
+}
+
+// Stop an audio buffer, called from the mixing thread
+static void StopAudioBufferInMixer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        if (buffer->playing)
+        {
+            ma_atomic_store_32(&buffer->playing, MA_FALSE);
+            ma_atomic_store_32(&buffer->paused, MA_FALSE);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->framesProcessed, 0);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], MA_TRUE);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], MA_TRUE);
+        }
+    }
+}
+
+// Check if a pool voice is playing (or paused) a sound
+static bool IsAudioVoiceInUse(AudioBuffer *voice)
+{
+    bool result = false;
+
+    if (voice->source != NULL)
+    {
+        if (IsAudioCommandPending(voice->lastCommand)) result = voice->requestedPlaying;
+        else result = ma_atomic_load_32(&voice->playing);
+    }
+
+    return result;
+}
+
+// Play a sound buffer on a free voice, stealing a voice in use if required
+// NOTE: Voice pool is managed by the program thread, sounds must be played from one thread
+static AudioBuffer *PlayAudioVoice(AudioBuffer *source, const Vector3 *position)
+{
+    AudioBuffer *voice = NULL;
+    AudioBuffer *candidate = NULL;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *current = AUDIO.Voice.voices[i];
+
+        if (!IsAudioVoiceInUse(current))
+        {
+            voice = current;
+            break;
+        }
+
+        // Steal candidate: lowest priority, then lowest volume, then oldest play
+        if ((candidate == NULL) ||
+            (current->priority < candidate->priority) ||
+            ((current->priority == candidate->priority) && (current->requestedVolume < candidate->requestedVolume)) ||
+            ((current->priority == candidate->priority) && (current->requestedVolume == candidate->requestedVolume) &&
+             ((int)(current->playOrder - candidate->playOrder) < 0))) candidate = current;
+    }
+
+    if (voice == NULL)
+    {
+        if ((candidate == NULL) || (candidate->priority > source->priority))
+        {
+            AUDIO.Voice.rejectedPlays++;
+            return NULL;
+        }
+
+        voice = candidate;
+        AUDIO.Voice.steals++;
+    }
+
+    voice->source = source;
+    voice->priority = source->priority;
+    voice->requestedVolume = source->requestedVolume;
+    voice->requestedPlaying = true;
+    voice->requestedPaused = false;
+    voice->playOrder = AUDIO.Voice.playCounter++;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_PLAY_VOICE, .buffer = voice, .source = source };
+
+    if (position != NULL)
+    {
+        ma_atomic_store_explicit_f32(&voice->position[0], position->x, ma_atomic_memory_order_relaxed);
+        ma_atomic_store_explicit_f32(&voice->position[1], position->y, ma_atomic_memory_order_relaxed);
+        ma_atomic_store_explicit_f32(&voice->position[2], position->z, ma_atomic_memory_order_relaxed);
+
+        command.distance[0] = (source->distance[1] > 0.0f)? source->distance[0] : AUDIO_SOUND_MIN_DISTANCE;
+        command.distance[1] = (source->distance[1] > 0.0f)? source->distance[1] : AUDIO_SOUND_MAX_DISTANCE;
+    }
+
+    voice->lastCommand = PostAudioCommand(command);
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+    return voice;
+}
+
+// Post a playback state command to all voices playing a sound buffer
+static void SetAudioVoicesState(AudioBuffer *source, int type)
+{
+    if (source == NULL) return;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *voice = AUDIO.Voice.voices[i];
+        if ((voice->source == source) && IsAudioVoiceInUse(voice)) PostAudioBufferState(voice, type);
+    }
+}
+
+// Post a volume, pitch or pan command to all voices playing a sound buffer
+static void SetAudioVoicesValue(AudioBuffer *source, int type, float value)
+{
+    if (source == NULL) return;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *voice = AUDIO.Voice.voices[i];
+
+        if ((voice->source == source) && IsAudioVoiceInUse(voice))
+        {
+            switch (type)
+            {
+                case AUDIO_COMMAND_VOLUME: SetAudioBufferVolume(voice, value); break;
+                case AUDIO_COMMAND_PITCH: SetAudioBufferPitch(voice, value); break;
+                case AUDIO_COMMAND_PAN: SetAudioBufferPan(voice, value); break;
+                default: break;
             }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
     }
 }
 
+// Stop all voices playing a sound buffer and detach them from it, sound is going to be unloaded
+static void ReleaseAudioVoices(AudioBuffer *source)
+{
+    if (source == NULL) return;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *voice = AUDIO.Voice.voices[i];
+
+        if (voice->source == source)
+        {
+            if (IsAudioVoiceInUse(voice)) PostAudioBufferState(voice, AUDIO_COMMAND_STOP);
+            voice->source = NULL;
+        }
+    }
+}
+
+// Load audio stream for a music, buffer length keeps AUDIO_MUSIC_BUFFER_DEPTH_MS decoded ahead of the mixer
+// NOTE: Default buffer size set by SetAudioStreamBufferSizeDefault() is used instead if defined
+static AudioStream LoadMusicAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    int defaultSize = AUDIO.Buffer.defaultSize;
+
+    // Stream buffer is split in two sub-buffers, one is refilled while the other is played
+    if (defaultSize == 0) AUDIO.Buffer.defaultSize = sampleRate*AUDIO_MUSIC_BUFFER_DEPTH_MS/2000;
+
+    AudioStream stream = LoadAudioStream(sampleRate, sampleSize, channels);
+
+    AUDIO.Buffer.defaultSize = defaultSize;
+
+    return stream;
+}
+
+// Register a loaded music to be refilled by the decoder
+static void AttachMusicDecoder(Music music)
+{
+    if (music.stream.buffer == NULL) return;
+
+    rMusicDecoder *decoder = (rMusicDecoder *)RL_CALLOC(1, sizeof(rMusicDecoder));
+
+    if (decoder == NULL)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music decoder");
+        return;
+    }
+
+    decoder->music = music;
+    decoder->looping = music.looping;
+
+    LockMusicDecoder();
+    decoder->next = AUDIO.Music.first;
+    AUDIO.Music.first = decoder;
+    UnlockMusicDecoder();
+}
+
+// Unregister a music from the decoder, decoder thread does not access it anymore once returned
+static void DetachMusicDecoder(Music music)
+{
+    LockMusicDecoder();
+
+    rMusicDecoder **link = &AUDIO.Music.first;
+    while ((*link != NULL) && ((*link)->music.stream.buffer != music.stream.buffer)) link = &(*link)->next;
+
+    if (*link != NULL)
+    {
+        rMusicDecoder *decoder = *link;
+        *link = decoder->next;
+        RL_FREE(decoder);
+    }
+
+    UnlockMusicDecoder();
+}
+
+// Get decoder of a music, NULL if not found
+static rMusicDecoder *GetMusicDecoder(Music music)
+{
+    if (music.stream.buffer == NULL) return NULL;
+
+    rMusicDecoder *decoder = AUDIO.Music.first;
+    while ((decoder != NULL) && (decoder->music.stream.buffer != music.stream.buffer)) decoder = decoder->next;
+
+    return decoder;
+}
+
+// Lock music contexts, decoder thread can not refill any music stream until unlocked
+static void LockMusicDecoder(void)
+{
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if (AUDIO.Music.isThreadRunning) ma_mutex_lock(&AUDIO.Music.lock);
+#endif
+}
+
+// Unlock music contexts
+static void UnlockMusicDecoder(void)
+{
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if (AUDIO.Music.isThreadRunning) ma_mutex_unlock(&AUDIO.Music.lock);
+#endif
+}
+
+// Refill processed music stream sub-buffers with decoded frames
+// NOTE: Decoder lock must be held, music context and pcm buffer are shared with the decoder thread
+static void UpdateMusicDecoder(rMusicDecoder *decoder)
+{
+    Music music = decoder->music;
+    bool looping = ma_atomic_load_32(&decoder->looping);
+
+    // Last frames already decoded, waiting for the mixer to play them
+    if (ma_atomic_load_32(&music.stream.buffer->isStreamEnding)) return;
+
+    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
+
+    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
+
+    if (AUDIO.System.pcmBufferSize < pcmSize)
+    {
+        RL_FREE(AUDIO.System.pcmBuffer);
+        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
+        AUDIO.System.pcmBufferSize = pcmSize;
+    }
+
+    // Check both sub-buffers to check if they require refilling
+    for (int i = 0; i < 2; i++)
+    {
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
+
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
+        unsigned int framesToStream = 0;                 // Total frames to be streamed
+
+        if ((framesLeft >= subBufferSizeInFrames) || looping) framesToStream = subBufferSizeInFrames;
+        else framesToStream = framesLeft;
+
+        int frameCountStillNeeded = framesToStream;
+        int frameCountReadTotal = 0;
+
+        ma_timer timer = { 0 };
+        ma_timer_init(&timer);
+
+        switch (music.ctxType)
+        {
+        #if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV:
+            {
+                if (music.stream.sampleSize == 16)
+                {
+                    while (true)
+                    {
+                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                        frameCountReadTotal += frameCountRead;
+                        frameCountStillNeeded -= frameCountRead;
+                        if (frameCountStillNeeded == 0) break;
+                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                    }
+                }
+                else if (music.stream.sampleSize == 32)
+                {
+                    while (true)
+                    {
+                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                        frameCountReadTotal += frameCountRead;
+                        frameCountStillNeeded -= frameCountRead;
+                        if (frameCountStillNeeded == 0) break;
+                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                    }
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG:
+            {
+                while (true)
+                {
+                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3:
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA:
+            {
+                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
+                frameCountReadTotal += frameCountRead;
+                /*
+                while (true)
+                {
+                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+                }
+                */
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC:
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
+                }
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_XM)
+            case MUSIC_MODULE_XM:
+            {
+                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
+                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+            } break;
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_MOD)
+            case MUSIC_MODULE_MOD:
+            {
+                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
+                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+            } break;
+        #endif
+            default: break;
+        }
+
+        double decodeTime = ma_timer_get_time_in_seconds(&timer);
+        decoder->decodeTime += decodeTime;
+        if (decodeTime > decoder->decodeTimeMax) decoder->decodeTimeMax = decodeTime;
+        decoder->decodeCount++;
+
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
+
+        if ((framesLeft <= subBufferSizeInFrames) && !looping)
+        {
+            // Streaming is ending, we filled latest frames from input, mixer stops the stream once
+            // they are played, context is moved back to the start for next play
+            RewindMusicStream(music);
+            ma_atomic_store_32(&music.stream.buffer->isStreamEnding, MA_TRUE);
+            return;
+        }
+    }
+}
+
+// Move music stream context back to the start
+// NOTE: Decoder lock must be held, context is shared with the decoder thread
+static void RewindMusicStream(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+// Music decoder thread, refills playing music streams once the mixer processes a sub-buffer
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data)
+{
+    (void)data;
+
+    // Polling several times per sub-buffer, decoding time is small compared to buffer length
+    const ma_uint32 sleepTime = (AUDIO_MUSIC_BUFFER_DEPTH_MS/8 > 0)? AUDIO_MUSIC_BUFFER_DEPTH_MS/8 : 1;
+
+    while (!ma_atomic_load_32(&AUDIO.Music.quit))
+    {
+        ma_mutex_lock(&AUDIO.Music.lock);
+
+        for (rMusicDecoder *decoder = AUDIO.Music.first; decoder != NULL; decoder = decoder->next)
+        {
+            if (ma_atomic_load_32(&decoder->music.stream.buffer->playing)) UpdateMusicDecoder(decoder);
+        }
+
+        ma_mutex_unlock(&AUDIO.Music.lock);
+
+        ma_sleep(sleepTime);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Create a sound using cached data, only a new buffer is allocated
+static Sound LoadSoundFromCache(rSoundCacheEntry *entry)
+{
+    Sound sound = { 0 };
+
+    AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+    if (audioBuffer == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+        return sound;
+    }
+
+    audioBuffer->sizeInFrames = entry->frameCount;
+    audioBuffer->data = entry->data;
+    audioBuffer->cache = entry;
+    entry->refCount++;
+
+    sound.frameCount = entry->frameCount;
+    sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+    sound.stream.sampleSize = 32;
+    sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+    sound.stream.buffer = audioBuffer;
+
+    TRACELOG(LOG_DEBUG, "SOUND: [%s] Sound data shared (%i sounds)", entry->fileName, entry->refCount);
+
+    return sound;
+}
+
+// Get cache entry for a sound file converted to current device format, NULL if not loaded
+static rSoundCacheEntry *GetSoundCacheEntry(const char *fileName)
+{
+    if (fileName == NULL) return NULL;
+
+    rSoundCacheEntry *entry = AUDIO.SoundCache.first;
+
+    while ((entry != NULL) && ((entry->sampleRate != AUDIO.System.device.sampleRate) || (strcmp(entry->fileName, fileName) != 0))) entry = entry->next;
+
+    return entry;
+}
+
+// Add a loaded sound to the cache, entry takes ownership of sound data
+static void AddSoundCacheEntry(const char *fileName, Sound sound)
+{
+    rSoundCacheEntry *entry = (rSoundCacheEntry *)RL_CALLOC(1, sizeof(rSoundCacheEntry));
+    if (entry == NULL) return;      // Sound keeps owning its data, not shared
+
+    entry->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(entry->fileName, fileName);
+    entry->sampleRate = sound.stream.sampleRate;
+    entry->data = sound.stream.buffer->data;
+    entry->frameCount = sound.stream.buffer->sizeInFrames;
+    entry->refCount = 1;
+
+    sound.stream.buffer->cache = entry;
+
+    entry->next = AUDIO.SoundCache.first;
+    AUDIO.SoundCache.first = entry;
+}
+
+// Release a sound reference to cached data, data is unloaded with the last one
+// NOTE: Mixer must not be reading the data anymore, buffers using it are already untracked
+static void ReleaseSoundCacheEntry(rSoundCacheEntry *entry)
+{
+    entry->refCount--;
+    if (entry->refCount > 0) return;
+
+    rSoundCacheEntry **link = &AUDIO.SoundCache.first;
+    while ((*link != NULL) && (*link != entry)) link = &(*link)->next;
+    if (*link != NULL) *link = entry->next;
+
+    RL_FREE(entry->data);
+    RL_FREE(entry->fileName);
+    RL_FREE(entry);
+}
+
+// Detach a buffer from its cache entry, buffer owns its data once returned (copy-on-write)
+// NOTE: Data is copied while other sounds use the entry, the last one takes the data and the entry is removed
+static bool DetachSoundCacheEntry(AudioBuffer *buffer)
+{
+    rSoundCacheEntry *entry = buffer->cache;
+
+    if (entry->refCount > 1)
+    {
+        unsigned int size = entry->frameCount*ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+        unsigned char *data = (unsigned char *)RL_MALLOC(size);
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to allocate memory for sound data copy");
+            return false;
+        }
+
+        memcpy(data, entry->data, size);
+        buffer->data = data;
+        buffer->cache = NULL;
+
+        ReleaseSoundCacheEntry(entry);
+    }
+    else
+    {
+        rSoundCacheEntry **link = &AUDIO.SoundCache.first;
+        while ((*link != NULL) && (*link != entry)) link = &(*link)->next;
+        if (*link != NULL) *link = entry->next;
+
+        buffer->cache = NULL;
+
+        RL_FREE(entry->fileName);
+        RL_FREE(entry);
+    }
+
+    return true;
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOA) && !defined(RAUDIO_STANDALONE)
+// Get disk cache file path for a sound file converted to current device format
+static const char *GetSoundDiskCachePath(const char *fileName)
+{
+    static char path[1024] = { 0 };
+
+    // FNV-1a hash of the sound file path, cache files are kept in a flat directory
+    unsigned int hash = 2166136261u;
+    for (const char *c = fileName; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+
+    snprintf(path, sizeof(path), "%s/%08x_%u_%u.qoa", AUDIO.SoundCache.directory, hash, AUDIO.System.device.sampleRate, AUDIO_DEVICE_CHANNELS);
+
+    return path;
+}
+#endif
+
+// Load converted sound data from disk cache, empty wave if not available or older than the sound file
+static Wave LoadSoundDiskCache(const char *fileName)
+{
+    Wave wave = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_QOA) && !defined(RAUDIO_STANDALONE)
+    if (AUDIO.SoundCache.directory != NULL)
+    {
+        const char *cachePath = GetSoundDiskCachePath(fileName);
+
+        if (FileExists(cachePath) && (GetFileModTime(cachePath) >= GetFileModTime(fileName)))
+        {
+            wave = LoadWave(cachePath);
+
+            // Cache must match device format, otherwise it's ignored and rebuilt
+            if ((wave.sampleRate != AUDIO.System.device.sampleRate) || (wave.channels != AUDIO_DEVICE_CHANNELS))
+            {
+                UnloadWave(wave);
+                wave = (Wave){ 0 };
+            }
+        }
+    }
+#endif
+
+    return wave;
+}
+
+// Save converted sound data to disk cache
+static void SaveSoundDiskCache(const char *fileName, Sound sound)
+{
+#if defined(SUPPORT_FILEFORMAT_QOA) && !defined(RAUDIO_STANDALONE)
+    if (AUDIO.SoundCache.directory != NULL)
+    {
+        if (!DirectoryExists(AUDIO.SoundCache.directory)) MakeDirectory(AUDIO.SoundCache.directory);
+
+        // QOA stores 16 bit samples, converted from device format
+        Wave wave = { 0 };
+        wave.frameCount = sound.frameCount;
+        wave.sampleRate = sound.stream.sampleRate;
+        wave.sampleSize = 16;
+        wave.channels = sound.stream.channels;
+        wave.data = RL_MALLOC(wave.frameCount*wave.channels*sizeof(short));
+
+        if (wave.data != NULL)
+        {
+            ma_convert_pcm_frames_format(wave.data, ma_format_s16, sound.stream.buffer->data, AUDIO_DEVICE_FORMAT, wave.frameCount, wave.channels, ma_dither_mode_none);
+
+            if (!ExportWave(wave, GetSoundDiskCachePath(fileName))) TRACELOG(LOG_WARNING, "SOUND: [%s] Failed to save disk cache", fileName);
+
+            UnloadWave(wave);
+        }
+    }
+#else
+    (void)fileName;
+    (void)sound;
+#endif
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
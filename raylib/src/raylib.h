@@ -322,6 +322,15 @@ typedef struct Font {
     GlyphInfo *glyphs;      // Glyphs info data
 } Font;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rDynamicFont rDynamicFont;
+
+// DynamicFont, glyphs rasterized on first use into a shared atlas, at any size
+typedef struct DynamicFont {
+    rDynamicFont *data;     // Pointer to internal font data (font file, atlas, glyphs map)
+} DynamicFont;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -476,6 +485,22 @@ typedef struct Sound {
     unsigned int frameCount;    // Total number of frames (considering channels)
 } Sound;
 
+// AudioVoiceStats, sounds voice pool usage
+typedef struct AudioVoiceStats {
+    int voiceCount;             // Total voices in the pool
+    int voicesInUse;            // Voices playing (or paused)
+    unsigned int steals;        // Sound plays that took over a voice in use
+    unsigned int rejectedPlays; // Sound plays dropped, all voices in use by higher priority sounds
+} AudioVoiceStats;
+
+// MusicStreamStats, music stream decoding stats
+typedef struct MusicStreamStats {
+    unsigned int underruns;     // Mixer reads that found no decoded frames ready (silence played)
+    float decodeTime;           // Average time to decode a stream sub-buffer (in seconds)
+    float decodeTimeMax;        // Longest time to decode a stream sub-buffer (in seconds)
+    float bufferedTime;         // Decoded audio ready ahead of the mixer (in seconds)
+} MusicStreamStats;
+
 // Music, audio stream, anything longer than ~10 seconds should be streamed
 typedef struct Music {
     AudioStream stream;         // Audio stream
@@ -518,6 +543,32 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// Frame memory stats, see MemAllocFrame()
+typedef struct FrameMemoryStats {
+    unsigned int used;              // Bytes allocated in current frame
+    unsigned int capacity;          // Arena block size in bytes, grown to peak on frame reset
+    unsigned int peak;              // Max bytes allocated in one frame (high-water mark)
+    unsigned int overflows;         // Overflow blocks allocated from the heap (allocations not fitting the arena block), total
+} FrameMemoryStats;
+
+// Memory stats, see GetMemoryStats()
+typedef struct MemoryStats {
+    long long liveBytes;            // Bytes allocated and not freed yet
+    long long peakBytes;            // Max live bytes
+    long long totalBytes;           // Bytes allocated since start (allocation rate over time)
+    unsigned int liveCount;         // Allocations not freed yet
+    unsigned int totalCount;        // Allocations since start
+} MemoryStats;
+
+// Frame pacing stats, see GetFramePacingStats()
+typedef struct FramePacingStats {
+    unsigned int frameCount;        // Frames paced since SetTargetFPS()
+    unsigned int missedCount;       // Frames longer than target time (plus FRAME_PACING_TOLERANCE)
+    float missRate;                 // Missed frames ratio [0..1]
+    float spinMargin;               // Time reserved to spin after sleeping (seconds), learned by WaitTime() from wake up lateness
+    float maxLateness;              // Max time a frame went over target time (seconds)
+} FramePacingStats;
+
 // Automation event
 typedef struct AutomationEvent {
     unsigned int frame;             // Event frame
@@ -557,6 +608,18 @@ typedef enum {
     FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
 } ConfigFlags;
 
+// Memory tags, subsystem raylib memory allocations are accounted to (SUPPORT_MEMORY_TRACKING)
+typedef enum {
+    MEMORY_TAG_USER = 0,            // MemAlloc() and utils module (file data, frame memory)
+    MEMORY_TAG_CORE,                // rcore: file paths lists, compression, screen captures, automation events
+    MEMORY_TAG_RLGL,                // rlgl: render batch, shaders locations
+    MEMORY_TAG_TEXTURES,            // rtextures: images, image file formats loaders
+    MEMORY_TAG_TEXT,                // rtext: fonts, glyphs, text strings
+    MEMORY_TAG_MODELS,              // rmodels: meshes, materials, animations, model file formats loaders
+    MEMORY_TAG_AUDIO,               // raudio: waves, sounds, music streams, audio device
+    MEMORY_TAG_ALL                  // All subsystems (totals)
+} MemoryTag;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -947,6 +1010,7 @@ typedef enum {
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
 typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSize);    // FileIO: Load binary data
+typedef void (*UnloadFileDataCallback)(unsigned char *data);            // FileIO: Unload binary data
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
@@ -1075,6 +1139,7 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
+RLAPI FramePacingStats GetFramePacingStats(void);                 // Get frame pacing stats (missed frames)
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1102,11 +1167,17 @@ RLAPI void SetTraceLogLevel(int logLevel);                        // Set the cur
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void *MemAllocFrame(unsigned int size);                     // Frame memory allocator, memory released on EndDrawing() (not initialized, main thread only)
+RLAPI FrameMemoryStats GetFrameMemoryStats(void);                 // Get frame memory allocator stats
+RLAPI MemoryStats GetMemoryStats(int tag);                        // Get memory allocations stats for a subsystem (MEMORY_TAG_ALL for totals)
+RLAPI const char *GetMemoryTagName(int tag);                      // Get memory tag subsystem name
+RLAPI void TraceMemoryStats(void);                                // Log memory usage by subsystem (CPU allocations and GPU resources)
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
 RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom file binary data loader
+RLAPI void SetUnloadFileDataCallback(UnloadFileDataCallback callback); // Set custom file binary data unloader
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
@@ -1351,6 +1422,7 @@ RLAPI Image ImageFromChannel(Image image, int selectedChannel);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int newFormat, int quality);                                      // Compress image data to GPU block format (DXT, ETC), quality: 0 (fast) to 2 (best)
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1363,6 +1435,7 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, bool srgb);                                                      // Compute all mipmap levels for a provided image, optionally averaging colors in linear space (sRGB images)
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1469,6 +1542,15 @@ RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
+// Dynamic font functions (glyphs rasterized on first use, several sizes share the same atlas)
+RLAPI DynamicFont LoadDynamicFont(const char *fileName);                                    // Load dynamic font from file (ttf/otf), no glyph rasterized until used
+RLAPI DynamicFont LoadDynamicFontFromMemory(const unsigned char *fileData, int dataSize);    // Load dynamic font from memory buffer (ttf/otf), data is copied
+RLAPI bool IsDynamicFontValid(DynamicFont font);                                            // Check if a dynamic font is valid
+RLAPI void UnloadDynamicFont(DynamicFont font);                                             // Unload dynamic font data and atlas (RAM/VRAM)
+RLAPI Texture2D GetDynamicFontTexture(DynamicFont font);                                    // Get dynamic font atlas texture, replaced when the atlas grows
+RLAPI void DrawTextDynamic(DynamicFont font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using dynamic font, missing glyphs rasterized at the requested size
+RLAPI Vector2 MeasureTextDynamic(DynamicFont font, const char *text, float fontSize, float spacing); // Measure string size for dynamic font
+
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
@@ -1501,7 +1583,7 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);        // Encod
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
-RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
+RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style), string valid until EndDrawing() (main thread only)
 RLAPI const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
 RLAPI char *TextReplace(const char *text, const char *replace, const char *by);             // Replace text string (WARNING: memory must be freed!)
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
@@ -1576,6 +1658,8 @@ RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void OptimizeMesh(Mesh *mesh);                                                        // Optimize mesh: weld vertices (indexed), reorder for vertex cache, overdraw and fetch
+RLAPI float GetMeshCacheMissRatio(Mesh mesh);                                               // Get mesh average post-transform cache miss ratio (ACMR)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1604,6 +1688,8 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
+RLAPI void UpdateModelAnimationEx(Model model, ModelAnimation anim, float frame);           // Update model animation pose (CPU), interpolating between frames
+RLAPI void UpdateModelAnimationBonesEx(Model model, ModelAnimation anim, float frame);      // Update model animation mesh bone matrices (GPU skinning), interpolating between frames
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -1626,6 +1712,9 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
+RLAPI void InitAudioDeviceOffline(int sampleRate, const char *fileName); // Initialize offline audio device (no audio hardware), WAV file saved on close if fileName provided
+RLAPI void RenderAudioFrames(int frameCount);                         // Mix frames on offline audio device
+RLAPI Wave LoadAudioDeviceWave(void);                                 // Load offline audio device rendered frames as wave
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
@@ -1642,6 +1731,7 @@ RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Updat
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
 RLAPI void UnloadSoundAlias(Sound alias);                             // Unload a sound alias (does not deallocate sample data)
+RLAPI void SetSoundCacheDirectory(const char *dirPath);               // Set directory to cache converted sounds on disk (QOA), NULL to disable
 RLAPI bool ExportWave(Wave wave, const char *fileName);               // Export wave data to file, returns true on success
 RLAPI bool ExportWaveAsCode(Wave wave, const char *fileName);         // Export wave sample data to code (.h), returns true on success
 
@@ -1654,6 +1744,12 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound voices, lower priority voices are stolen first (0 is default)
+RLAPI AudioVoiceStats GetAudioVoiceStats(void);                       // Get sounds voice pool usage stats
+RLAPI void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up); // Set listener position and orientation for positional sounds (i.e. from camera)
+RLAPI int PlaySoundAt(Sound sound, Vector3 position);                 // Play a sound at a world position, returns voice id to move it (-1 if not played)
+RLAPI void SetSoundVoicePosition(int voice, Vector3 position);        // Set world position of a positional sound voice
+RLAPI void SetSoundDistance(Sound sound, float minDistance, float maxDistance); // Set positional sound attenuation distances, culled beyond maxDistance
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1667,7 +1763,7 @@ RLAPI bool IsMusicValid(Music music);                                 // Checks
 RLAPI void UnloadMusicStream(Music music);                            // Unload music stream
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI bool IsMusicStreamPlaying(Music music);                         // Check if music is playing
-RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
+RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming (not required if music decoder thread is enabled)
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
@@ -1677,6 +1773,7 @@ RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pit
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI MusicStreamStats GetMusicStreamStats(Music music);              // Get music stream decoding stats (underruns, decode time)
 
 // AudioStream management functions
 RLAPI AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
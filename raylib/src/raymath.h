@@ -30,6 +30,10 @@
 *       #define RAYMATH_DISABLE_CPP_OPERATORS
 *           Disables C++ operator overloads for raymath types.
 *
+*       #define RAYMATH_DISABLE_SIMD
+*           Disables SIMD code paths (AVX2, SSE2 or NEON, selected at compile time from target
+*           architecture flags) used by batch functions (*Array), scalar code is used instead.
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2015-2024 Ramon Santamaria (@raysan5)
@@ -169,6 +173,23 @@ typedef struct float16 {
 } float16;
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
+#include <stddef.h>     // Required for: size_t
+
+// SIMD instruction set selection for batch functions
+#if !defined(RAYMATH_DISABLE_SIMD)
+    #if defined(__AVX2__)
+        #define RAYMATH_SIMD_AVX2
+        #include <immintrin.h>  // Required for: AVX2 intrinsics
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAYMATH_SIMD_SSE2
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #if defined(__aarch64__) || defined(_M_ARM64)   // Required for: vdivq_f32(), vsqrtq_f32()
+            #define RAYMATH_SIMD_NEON
+            #include <arm_neon.h>   // Required for: NEON intrinsics
+        #endif
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
@@ -2588,6 +2609,342 @@ RMAPI void MatrixDecompose(Matrix mat, Vector3 *translation, Quaternion *rotatio
     }
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector3 batch math
+//----------------------------------------------------------------------------------
+// NOTE: Batch functions process arrays of Vector3 with a byte stride between elements,
+// so they can work on packed Vector3 arrays (stride = 0 or sizeof(Vector3)), mesh vertex
+// float arrays or arrays of structs containing a Vector3 (stride = sizeof(struct))
+// Output is computed the same way as the equivalent single Vector3 function
+// WARNING: SIMD paths require stride to be a multiple of 4 bytes, scalar path is used otherwise
+
+#if defined(RAYMATH_SIMD_AVX2) || defined(RAYMATH_SIMD_SSE2)
+    // Load/store of strided points are done by rows of 4 floats (x, y, z, next) transposed to
+    // separated x, y, z components, AVX2 processes 2 groups of 4 points on every 128bit lane
+    // WARNING: Rows read one float past each point, so at least one more point must follow in the array
+    #define RAYMATH_SIMD_ROW(points, stride, i) _mm_loadu_ps((const float *)((const char *)(points) + (size_t)(i)*(stride)))
+    #define RAYMATH_SIMD_STORE_ROW(result, stride, i, row) { \
+        float *p_ = (float *)((char *)(result) + (size_t)(i)*(stride)); \
+        _mm_storel_pi((__m64 *)p_, row); _mm_store_ss(p_ + 2, _mm_movehl_ps(row, row)); }
+
+    // Load/store of 4 packed points (stride = 12 bytes) using 3 vectors: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+    #define RAYMATH_SIMD_LOAD3_PACKED(ptr, x, y, z) { \
+        __m128 a_ = _mm_loadu_ps(ptr), b_ = _mm_loadu_ps((ptr) + 4), c_ = _mm_loadu_ps((ptr) + 8); \
+        x = _mm_shuffle_ps(a_, _mm_shuffle_ps(b_, c_, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)); \
+        y = _mm_shuffle_ps(_mm_shuffle_ps(a_, b_, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b_, c_, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)); \
+        z = _mm_shuffle_ps(_mm_shuffle_ps(a_, b_, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c_, c_, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)); }
+    #define RAYMATH_SIMD_STORE3_PACKED(ptr, x, y, z) { \
+        _mm_storeu_ps(ptr, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0))); \
+        _mm_storeu_ps((ptr) + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0))); \
+        _mm_storeu_ps((ptr) + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))); }
+#endif
+
+#if defined(RAYMATH_SIMD_AVX2)
+    #define RAYMATH_SIMD_LANES      8
+    typedef __m256 rmSimdFloat;
+    #define RAYMATH_SIMD_SET1(a)        _mm256_set1_ps(a)
+    #define RAYMATH_SIMD_ADD(a, b)      _mm256_add_ps(a, b)
+    #define RAYMATH_SIMD_SUB(a, b)      _mm256_sub_ps(a, b)
+    #define RAYMATH_SIMD_MUL(a, b)      _mm256_mul_ps(a, b)
+    #define RAYMATH_SIMD_DIV(a, b)      _mm256_div_ps(a, b)
+    #define RAYMATH_SIMD_MIN(a, b)      _mm256_min_ps(a, b)
+    #define RAYMATH_SIMD_MAX(a, b)      _mm256_max_ps(a, b)
+    #define RAYMATH_SIMD_SQRT(a)        _mm256_sqrt_ps(a)
+    #define RAYMATH_SIMD_STORE(p, a)    _mm256_storeu_ps(p, a)
+    // Select a where value != 0.0f, b otherwise
+    #define RAYMATH_SIMD_SELECT_NONZERO(value, a, b) _mm256_blendv_ps(b, a, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_NEQ_UQ))
+
+    // Load 8 strided points as separated x, y, z components
+    #define RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z) if ((stride) == 12) { \
+        const float *p_ = (const float *)((const char *)(points) + (size_t)(i)*12); \
+        __m128 xl_, yl_, zl_, xh_, yh_, zh_; \
+        RAYMATH_SIMD_LOAD3_PACKED(p_, xl_, yl_, zl_); RAYMATH_SIMD_LOAD3_PACKED(p_ + 12, xh_, yh_, zh_); \
+        x = _mm256_insertf128_ps(_mm256_castps128_ps256(xl_), xh_, 1); \
+        y = _mm256_insertf128_ps(_mm256_castps128_ps256(yl_), yh_, 1); \
+        z = _mm256_insertf128_ps(_mm256_castps128_ps256(zl_), zh_, 1); } \
+    else { \
+        __m256 a0_ = _mm256_insertf128_ps(_mm256_castps128_ps256(RAYMATH_SIMD_ROW(points, stride, (i))), RAYMATH_SIMD_ROW(points, stride, (i) + 4), 1); \
+        __m256 a1_ = _mm256_insertf128_ps(_mm256_castps128_ps256(RAYMATH_SIMD_ROW(points, stride, (i) + 1)), RAYMATH_SIMD_ROW(points, stride, (i) + 5), 1); \
+        __m256 a2_ = _mm256_insertf128_ps(_mm256_castps128_ps256(RAYMATH_SIMD_ROW(points, stride, (i) + 2)), RAYMATH_SIMD_ROW(points, stride, (i) + 6), 1); \
+        __m256 a3_ = _mm256_insertf128_ps(_mm256_castps128_ps256(RAYMATH_SIMD_ROW(points, stride, (i) + 3)), RAYMATH_SIMD_ROW(points, stride, (i) + 7), 1); \
+        __m256 t0_ = _mm256_unpacklo_ps(a0_, a1_), t1_ = _mm256_unpacklo_ps(a2_, a3_); \
+        __m256 t2_ = _mm256_unpackhi_ps(a0_, a1_), t3_ = _mm256_unpackhi_ps(a2_, a3_); \
+        x = _mm256_shuffle_ps(t0_, t1_, _MM_SHUFFLE(1, 0, 1, 0)); \
+        y = _mm256_shuffle_ps(t0_, t1_, _MM_SHUFFLE(3, 2, 3, 2)); \
+        z = _mm256_shuffle_ps(t2_, t3_, _MM_SHUFFLE(1, 0, 1, 0)); }
+
+    // Store separated x, y, z components as 8 strided points (only 3 floats written per point)
+    #define RAYMATH_SIMD_STORE3(result, stride, i, x, y, z) if ((stride) == 12) { \
+        float *p_ = (float *)((char *)(result) + (size_t)(i)*12); \
+        RAYMATH_SIMD_STORE3_PACKED(p_, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z)); \
+        RAYMATH_SIMD_STORE3_PACKED(p_ + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1)); } \
+    else { \
+        __m256 t0_ = _mm256_unpacklo_ps(x, y), t1_ = _mm256_unpackhi_ps(x, y); \
+        __m256 t2_ = _mm256_unpacklo_ps(z, z), t3_ = _mm256_unpackhi_ps(z, z); \
+        __m256 r0_ = _mm256_shuffle_ps(t0_, t2_, _MM_SHUFFLE(1, 0, 1, 0)), r1_ = _mm256_shuffle_ps(t0_, t2_, _MM_SHUFFLE(3, 2, 3, 2)); \
+        __m256 r2_ = _mm256_shuffle_ps(t1_, t3_, _MM_SHUFFLE(1, 0, 1, 0)), r3_ = _mm256_shuffle_ps(t1_, t3_, _MM_SHUFFLE(3, 2, 3, 2)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i), _mm256_castps256_ps128(r0_)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 1, _mm256_castps256_ps128(r1_)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 2, _mm256_castps256_ps128(r2_)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 3, _mm256_castps256_ps128(r3_)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 4, _mm256_extractf128_ps(r0_, 1)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 5, _mm256_extractf128_ps(r1_, 1)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 6, _mm256_extractf128_ps(r2_, 1)); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 7, _mm256_extractf128_ps(r3_, 1)); }
+#elif defined(RAYMATH_SIMD_SSE2)
+    #define RAYMATH_SIMD_LANES      4
+    typedef __m128 rmSimdFloat;
+    #define RAYMATH_SIMD_SET1(a)        _mm_set1_ps(a)
+    #define RAYMATH_SIMD_ADD(a, b)      _mm_add_ps(a, b)
+    #define RAYMATH_SIMD_SUB(a, b)      _mm_sub_ps(a, b)
+    #define RAYMATH_SIMD_MUL(a, b)      _mm_mul_ps(a, b)
+    #define RAYMATH_SIMD_DIV(a, b)      _mm_div_ps(a, b)
+    #define RAYMATH_SIMD_MIN(a, b)      _mm_min_ps(a, b)
+    #define RAYMATH_SIMD_MAX(a, b)      _mm_max_ps(a, b)
+    #define RAYMATH_SIMD_SQRT(a)        _mm_sqrt_ps(a)
+    #define RAYMATH_SIMD_STORE(p, a)    _mm_storeu_ps(p, a)
+    #define RAYMATH_SIMD_SELECT_NONZERO(value, a, b) _mm_or_ps(_mm_and_ps(_mm_cmpneq_ps(value, _mm_setzero_ps()), a), _mm_andnot_ps(_mm_cmpneq_ps(value, _mm_setzero_ps()), b))
+
+    // Load 4 strided points as separated x, y, z components
+    #define RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z) if ((stride) == 12) { \
+        RAYMATH_SIMD_LOAD3_PACKED((const float *)((const char *)(points) + (size_t)(i)*12), x, y, z); } \
+    else { \
+        __m128 r0_ = RAYMATH_SIMD_ROW(points, stride, (i)), r1_ = RAYMATH_SIMD_ROW(points, stride, (i) + 1); \
+        __m128 r2_ = RAYMATH_SIMD_ROW(points, stride, (i) + 2), r3_ = RAYMATH_SIMD_ROW(points, stride, (i) + 3); \
+        _MM_TRANSPOSE4_PS(r0_, r1_, r2_, r3_); \
+        x = r0_; y = r1_; z = r2_; }
+
+    // Store separated x, y, z components as 4 strided points (only 3 floats written per point)
+    #define RAYMATH_SIMD_STORE3(result, stride, i, x, y, z) if ((stride) == 12) { \
+        RAYMATH_SIMD_STORE3_PACKED((float *)((char *)(result) + (size_t)(i)*12), x, y, z); } \
+    else { \
+        __m128 r0_ = x, r1_ = y, r2_ = z, r3_ = z; \
+        _MM_TRANSPOSE4_PS(r0_, r1_, r2_, r3_); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i), r0_); RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 1, r1_); \
+        RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 2, r2_); RAYMATH_SIMD_STORE_ROW(result, stride, (i) + 3, r3_); }
+#elif defined(RAYMATH_SIMD_NEON)
+    #define RAYMATH_SIMD_LANES      4
+    typedef float32x4_t rmSimdFloat;
+    #define RAYMATH_SIMD_SET1(a)        vdupq_n_f32(a)
+    #define RAYMATH_SIMD_ADD(a, b)      vaddq_f32(a, b)
+    #define RAYMATH_SIMD_SUB(a, b)      vsubq_f32(a, b)
+    #define RAYMATH_SIMD_MUL(a, b)      vmulq_f32(a, b)
+    #define RAYMATH_SIMD_DIV(a, b)      vdivq_f32(a, b)
+    #define RAYMATH_SIMD_MIN(a, b)      vminq_f32(a, b)
+    #define RAYMATH_SIMD_MAX(a, b)      vmaxq_f32(a, b)
+    #define RAYMATH_SIMD_SQRT(a)        vsqrtq_f32(a)
+    #define RAYMATH_SIMD_STORE(p, a)    vst1q_f32(p, a)
+    #define RAYMATH_SIMD_SELECT_NONZERO(value, a, b) vbslq_f32(vmvnq_u32(vceqq_f32(value, vdupq_n_f32(0.0f))), a, b)
+
+    // Load 4 strided points as separated x, y, z components (packed points use deinterleaved load)
+    #define RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z) { \
+        const float *p_ = (const float *)((const char *)(points) + (size_t)(i)*(stride)); \
+        if ((stride) == 12) { float32x4x3_t v_ = vld3q_f32(p_); x = v_.val[0]; y = v_.val[1]; z = v_.val[2]; } \
+        else { \
+            float32x4x3_t v_ = { { vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f) } }; \
+            v_ = vld3q_lane_f32(p_, v_, 0); v_ = vld3q_lane_f32((const float *)((const char *)p_ + (stride)), v_, 1); \
+            v_ = vld3q_lane_f32((const float *)((const char *)p_ + 2*(stride)), v_, 2); v_ = vld3q_lane_f32((const float *)((const char *)p_ + 3*(stride)), v_, 3); \
+            x = v_.val[0]; y = v_.val[1]; z = v_.val[2]; } }
+
+    // Store separated x, y, z components as 4 strided points (only 3 floats written per point)
+    #define RAYMATH_SIMD_STORE3(result, stride, i, x, y, z) { \
+        float *p_ = (float *)((char *)(result) + (size_t)(i)*(stride)); \
+        float32x4x3_t v_ = { { x, y, z } }; \
+        if ((stride) == 12) vst3q_f32(p_, v_); \
+        else { \
+            vst3q_lane_f32(p_, v_, 0); vst3q_lane_f32((float *)((char *)p_ + (stride)), v_, 1); \
+            vst3q_lane_f32((float *)((char *)p_ + 2*(stride)), v_, 2); vst3q_lane_f32((float *)((char *)p_ + 3*(stride)), v_, 3); } }
+#endif
+
+#if defined(RAYMATH_SIMD_LANES)
+    // SIMD blocks are processed while at least one more point follows the block (see SSE2/AVX2 loads)
+    #define RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride) ((((stride)%4) == 0) && (((i) + RAYMATH_SIMD_LANES) < (count)))
+#endif
+
+// Transform an array of Vector3 by a given Matrix
+RMAPI void Vector3TransformArray(const Vector3 *points, int stride, int count, Matrix mat, Vector3 *result, int resultStride)
+{
+    if (stride == 0) stride = sizeof(Vector3);
+    if (resultStride == 0) resultStride = sizeof(Vector3);
+
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_LANES)
+    if ((resultStride%4) == 0)
+    {
+        rmSimdFloat m0 = RAYMATH_SIMD_SET1(mat.m0), m4 = RAYMATH_SIMD_SET1(mat.m4), m8 = RAYMATH_SIMD_SET1(mat.m8), m12 = RAYMATH_SIMD_SET1(mat.m12);
+        rmSimdFloat m1 = RAYMATH_SIMD_SET1(mat.m1), m5 = RAYMATH_SIMD_SET1(mat.m5), m9 = RAYMATH_SIMD_SET1(mat.m9), m13 = RAYMATH_SIMD_SET1(mat.m13);
+        rmSimdFloat m2 = RAYMATH_SIMD_SET1(mat.m2), m6 = RAYMATH_SIMD_SET1(mat.m6), m10 = RAYMATH_SIMD_SET1(mat.m10), m14 = RAYMATH_SIMD_SET1(mat.m14);
+
+        for (; RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride); i += RAYMATH_SIMD_LANES)
+        {
+            rmSimdFloat x, y, z;
+            RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z);
+
+            rmSimdFloat rx = RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_MUL(m0, x), RAYMATH_SIMD_MUL(m4, y)), RAYMATH_SIMD_MUL(m8, z)), m12);
+            rmSimdFloat ry = RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_MUL(m1, x), RAYMATH_SIMD_MUL(m5, y)), RAYMATH_SIMD_MUL(m9, z)), m13);
+            rmSimdFloat rz = RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_MUL(m2, x), RAYMATH_SIMD_MUL(m6, y)), RAYMATH_SIMD_MUL(m10, z)), m14);
+
+            RAYMATH_SIMD_STORE3(result, resultStride, i, rx, ry, rz);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const Vector3 *v = (const Vector3 *)((const char *)points + (size_t)i*stride);
+        Vector3 *r = (Vector3 *)((char *)result + (size_t)i*resultStride);
+
+        float x = v->x;
+        float y = v->y;
+        float z = v->z;
+
+        r->x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        r->y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        r->z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Get min and max components of an array of Vector3 (axis aligned bounds)
+RMAPI void Vector3MinMaxArray(const Vector3 *points, int stride, int count, Vector3 *min, Vector3 *max)
+{
+    if (count <= 0) return;
+    if (stride == 0) stride = sizeof(Vector3);
+
+    Vector3 vmin = points[0];
+    Vector3 vmax = points[0];
+
+    int i = 1;
+
+#if defined(RAYMATH_SIMD_LANES)
+    if (RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride))
+    {
+        rmSimdFloat minX = RAYMATH_SIMD_SET1(vmin.x), minY = RAYMATH_SIMD_SET1(vmin.y), minZ = RAYMATH_SIMD_SET1(vmin.z);
+        rmSimdFloat maxX = minX, maxY = minY, maxZ = minZ;
+
+        for (; RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride); i += RAYMATH_SIMD_LANES)
+        {
+            rmSimdFloat x, y, z;
+            RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z);
+
+            minX = RAYMATH_SIMD_MIN(minX, x); minY = RAYMATH_SIMD_MIN(minY, y); minZ = RAYMATH_SIMD_MIN(minZ, z);
+            maxX = RAYMATH_SIMD_MAX(maxX, x); maxY = RAYMATH_SIMD_MAX(maxY, y); maxZ = RAYMATH_SIMD_MAX(maxZ, z);
+        }
+
+        float lanes[6][RAYMATH_SIMD_LANES];
+        RAYMATH_SIMD_STORE(lanes[0], minX); RAYMATH_SIMD_STORE(lanes[1], minY); RAYMATH_SIMD_STORE(lanes[2], minZ);
+        RAYMATH_SIMD_STORE(lanes[3], maxX); RAYMATH_SIMD_STORE(lanes[4], maxY); RAYMATH_SIMD_STORE(lanes[5], maxZ);
+
+        for (int l = 0; l < RAYMATH_SIMD_LANES; l++)
+        {
+            vmin.x = fminf(vmin.x, lanes[0][l]); vmin.y = fminf(vmin.y, lanes[1][l]); vmin.z = fminf(vmin.z, lanes[2][l]);
+            vmax.x = fmaxf(vmax.x, lanes[3][l]); vmax.y = fmaxf(vmax.y, lanes[4][l]); vmax.z = fmaxf(vmax.z, lanes[5][l]);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const Vector3 *v = (const Vector3 *)((const char *)points + (size_t)i*stride);
+
+        vmin.x = fminf(vmin.x, v->x); vmin.y = fminf(vmin.y, v->y); vmin.z = fminf(vmin.z, v->z);
+        vmax.x = fmaxf(vmax.x, v->x); vmax.y = fmaxf(vmax.y, v->y); vmax.z = fmaxf(vmax.z, v->z);
+    }
+
+    *min = vmin;
+    *max = vmax;
+}
+
+// Calculate square distance from an array of Vector3 to a given Vector3
+RMAPI void Vector3DistanceSqrArray(const Vector3 *points, int stride, int count, Vector3 v, float *result)
+{
+    if (stride == 0) stride = sizeof(Vector3);
+
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_LANES)
+    rmSimdFloat vx = RAYMATH_SIMD_SET1(v.x), vy = RAYMATH_SIMD_SET1(v.y), vz = RAYMATH_SIMD_SET1(v.z);
+
+    for (; RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride); i += RAYMATH_SIMD_LANES)
+    {
+        rmSimdFloat x, y, z;
+        RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z);
+
+        rmSimdFloat dx = RAYMATH_SIMD_SUB(x, vx);
+        rmSimdFloat dy = RAYMATH_SIMD_SUB(y, vy);
+        rmSimdFloat dz = RAYMATH_SIMD_SUB(z, vz);
+
+        RAYMATH_SIMD_STORE(result + i, RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_MUL(dx, dx), RAYMATH_SIMD_MUL(dy, dy)), RAYMATH_SIMD_MUL(dz, dz)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const Vector3 *p = (const Vector3 *)((const char *)points + (size_t)i*stride);
+
+        float dx = p->x - v.x;
+        float dy = p->y - v.y;
+        float dz = p->z - v.z;
+
+        result[i] = dx*dx + dy*dy + dz*dz;
+    }
+}
+
+// Normalize an array of Vector3 (zero length vectors are kept unchanged)
+RMAPI void Vector3NormalizeArray(const Vector3 *points, int stride, int count, Vector3 *result, int resultStride)
+{
+    if (stride == 0) stride = sizeof(Vector3);
+    if (resultStride == 0) resultStride = sizeof(Vector3);
+
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_LANES)
+    if ((resultStride%4) == 0)
+    {
+        rmSimdFloat one = RAYMATH_SIMD_SET1(1.0f);
+
+        for (; RAYMATH_SIMD_BLOCK_AVAILABLE(i, count, stride); i += RAYMATH_SIMD_LANES)
+        {
+            rmSimdFloat x, y, z;
+            RAYMATH_SIMD_LOAD3(points, stride, i, x, y, z);
+
+            rmSimdFloat length = RAYMATH_SIMD_SQRT(RAYMATH_SIMD_ADD(RAYMATH_SIMD_ADD(RAYMATH_SIMD_MUL(x, x), RAYMATH_SIMD_MUL(y, y)), RAYMATH_SIMD_MUL(z, z)));
+            rmSimdFloat ilength = RAYMATH_SIMD_DIV(one, length);
+
+            x = RAYMATH_SIMD_SELECT_NONZERO(length, RAYMATH_SIMD_MUL(x, ilength), x);
+            y = RAYMATH_SIMD_SELECT_NONZERO(length, RAYMATH_SIMD_MUL(y, ilength), y);
+            z = RAYMATH_SIMD_SELECT_NONZERO(length, RAYMATH_SIMD_MUL(z, ilength), z);
+
+            RAYMATH_SIMD_STORE3(result, resultStride, i, x, y, z);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const Vector3 *v = (const Vector3 *)((const char *)points + (size_t)i*stride);
+        Vector3 *r = (Vector3 *)((char *)result + (size_t)i*resultStride);
+
+        float x = v->x;
+        float y = v->y;
+        float z = v->z;
+
+        float length = sqrtf(x*x + y*y + z*z);
+        if (length != 0.0f)
+        {
+            float ilength = 1.0f/length;
+
+            x *= ilength;
+            y *= ilength;
+            z *= ilength;
+        }
+
+        r->x = x;
+        r->y = y;
+        r->z = z;
+    }
+}
+
 #if defined(__cplusplus) && !defined(RAYMATH_DISABLE_CPP_OPERATORS)
 
 // Optional C++ math operators
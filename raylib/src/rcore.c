@@ -39,10 +39,12 @@
 *           Use busy wait loop for timing sync, if not defined, a high-resolution timer is setup and used
 *
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
-*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
+*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end,
+*           the busy-wait time is learned from measured sleep overshoot (WAIT_OVERSHOOT_PERCENTILE) and yields the CPU
 *
 *       #define SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
+*           NOTE: Screen pixels are read asynchronously (pixel buffers) and encoded on background thread
 *
 *       #define SUPPORT_GIF_RECORDING
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
@@ -90,9 +92,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -102,16 +104,22 @@
     #include "config.h"             // Defines module configuration flags
 #endif
 
+#define RL_MEMORY_TAG MEMORY_TAG_CORE   // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"                  // Required for: TRACELOG() macros
 
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
-#include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <time.h>                   // Required for: time() [Used in InitTimer()], clock_nanosleep() [Used in WaitTime()]
+#include <errno.h>                  // Required for: EINTR [Used in WaitTime()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
+#undef RL_MEMORY_TAG
+#define RL_MEMORY_TAG MEMORY_TAG_RLGL   // rlgl allocations accounted apart from rcore ones
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
+#undef RL_MEMORY_TAG
+#define RL_MEMORY_TAG MEMORY_TAG_CORE
 
 #define RAYMATH_IMPLEMENTATION
 #include "raymath.h"                // Vector2, Vector3, Quaternion and Matrix functionality
@@ -253,6 +261,42 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_SCREEN_CAPTURES
+    #define MAX_SCREEN_CAPTURES            8        // Maximum number of screen captures in flight (pixel buffers)
+#endif
+#ifndef SCREEN_CAPTURE_LATENCY
+    #define SCREEN_CAPTURE_LATENCY         3        // Frames between a screen capture and its pixels readback, avoids stalling on GPU
+#endif
+
+#ifndef WAIT_OVERSHOOT_SAMPLES
+    #define WAIT_OVERSHOOT_SAMPLES        64        // Wake up lateness samples used to learn the spin margin
+#endif
+#ifndef WAIT_OVERSHOOT_PERCENTILE
+    #define WAIT_OVERSHOOT_PERCENTILE      0.95     // Wake up lateness percentile covered by the spin margin
+#endif
+#ifndef WAIT_SPIN_MARGIN
+    #define WAIT_SPIN_MARGIN               0.001    // Initial spin margin in seconds, until lateness samples are measured
+#endif
+#ifndef WAIT_SPIN_MARGIN_MIN
+    #define WAIT_SPIN_MARGIN_MIN           0.0002   // Minimum spin margin in seconds
+#endif
+#ifndef WAIT_SPIN_MARGIN_MAX
+    #define WAIT_SPIN_MARGIN_MAX           0.002    // Maximum spin margin in seconds
+#endif
+#ifndef WAIT_SPIN_MARGIN_RATIO
+    #define WAIT_SPIN_MARGIN_RATIO         0.05     // Maximum spin margin as a ratio of the wait time
+#endif
+#ifndef FRAME_PACING_TOLERANCE
+    #define FRAME_PACING_TOLERANCE         0.0005   // Time in seconds a frame can go over target time before counted as missed
+#endif
+
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // Gif recording frames per second
+#endif
+#ifndef GIF_RECORD_BITRATE
+    #define GIF_RECORD_BITRATE            16        // Gif recording color quantization bit depth
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
@@ -361,6 +405,9 @@ typedef struct CoreData {
         double target;                      // Desired time for one frame, if 0 not applied
         unsigned long long int base;        // Base time measure for hi-res timer (PLATFORM_ANDROID, PLATFORM_DRM)
         unsigned int frameCounter;          // Frame counter
+        unsigned int pacedFrames;           // Frames paced since SetTargetFPS()
+        unsigned int missedFrames;          // Frames over target time (FRAME_PACING_TOLERANCE)
+        double maxLateness;                 // Max time a frame went over target time
 
     } Time;
 } CoreData;
@@ -378,13 +425,54 @@ CoreData CORE = { 0 };                      // Global CORE state context
 bool isGpuReady = false;
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
+// Screen capture type
+typedef enum {
+    SCREEN_CAPTURE_NONE = 0,
+    SCREEN_CAPTURE_SCREENSHOT,      // Screenshot, exported as png
+    SCREEN_CAPTURE_GIF_BEGIN,       // Gif recording start
+    SCREEN_CAPTURE_GIF_FRAME,       // Gif recording frame
+    SCREEN_CAPTURE_GIF_END          // Gif recording end, saved if file name provided
+} ScreenCaptureType;
+
+// Screen capture in flight, pixels are read asynchronously and collected some frames later
+typedef struct ScreenCapture {
+    ScreenCaptureType type;         // Capture type, SCREEN_CAPTURE_NONE if not in flight
+    unsigned int pixelBuffer;       // Pixel pack buffer id (pbo), 0 if not supported
+    int bufferSize;                 // Pixel pack buffer size in bytes
+    int width;                      // Captured width
+    int height;                     // Captured height
+    int delay;                      // Gif frame delay in centiseconds
+    unsigned int frame;             // Frame the capture was requested
+    char fileName[512];             // Screenshot file path
+} ScreenCapture;
+
+// Screen capture encoding task, runs on background thread
+typedef struct ScreenCaptureTask {
+    ScreenCaptureType type;         // Capture type
+    unsigned char *pixels;          // Captured pixels (RGBA), top-left origin
+    int width;                      // Captured width
+    int height;                     // Captured height
+    int delay;                      // Gif frame delay in centiseconds
+    char fileName[512];             // Output file path
+} ScreenCaptureTask;
+
 static int screenshotCounter = 0;           // Screenshots counter
+static bool screenshotRequested = false;    // Screenshot requested (F12), captured on next frame before swapping buffers
+static ScreenCapture screenCaptures[MAX_SCREEN_CAPTURES] = { 0 };  // Screen captures in flight
+static unsigned int screenCaptureFrame = 0; // Frames counter to collect screen captures
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
 static unsigned int gifFrameCounter = 0;    // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+static MsfGifState gifState = { 0 };        // MSGIF context state, only accessed by background thread while recording
+#endif
+
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+static double wakeLateness[WAIT_OVERSHOOT_SAMPLES] = { 0 };     // Last waits lateness from wake up time, measured in WaitTime()
+static int wakeLatenessCount = 0;           // Wake up lateness samples measured (up to WAIT_OVERSHOOT_SAMPLES)
+static int wakeLatenessIndex = 0;           // Next wake up lateness sample to replace
+static double spinMargin = WAIT_SPIN_MARGIN;    // Time reserved to busy-wait after sleeping, learned from wake up lateness
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -499,6 +587,19 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+static void UpdateSpinMargin(double lateness);              // Add a wake up lateness sample and update spin margin (WAIT_OVERSHOOT_PERCENTILE)
+#endif
+
+#if defined(SUPPORT_SCREEN_CAPTURE)
+static void RequestScreenCapture(ScreenCaptureType type, const char *fileName, int delay); // Start reading screen pixels, collected SCREEN_CAPTURE_LATENCY frames later
+static void CollectScreenCapture(ScreenCapture *capture);  // Read captured pixels and queue them for encoding
+static void UpdateScreenCaptures(bool flush);           // Collect screen captures ready (or all of them if flush), in capture order
+static void UnloadScreenCaptures(void);                 // Unload screen captures pixel buffers
+static void RunScreenCaptureTask(ScreenCaptureType type, unsigned char *pixels, int width, int height, int delay, const char *fileName); // Queue screen capture encoding task
+static void EncodeScreenCapture(void *userData);        // Encode/save screen capture (background task)
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -721,21 +822,30 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if defined(SUPPORT_SCREEN_CAPTURE)
+    UpdateScreenCaptures(true);
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
+        RunScreenCaptureTask(SCREEN_CAPTURE_GIF_END, NULL, 0, 0, 0, NULL);  // Recording discarded
         gifRecording = false;
     }
 #endif
 
+    WaitWorkerTasks();          // Wait for pending screenshots to be saved
+    UnloadScreenCaptures();
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
     rlglClose();                // De-init rlgl
 
+    CloseWorkerThreads();       // Close worker threads pool (if created)
+    UnloadFrameMemory();        // Unload frame memory arena (if allocated)
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -888,32 +998,32 @@ void EndDrawing(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
-#if defined(SUPPORT_GIF_RECORDING)
+#if defined(SUPPORT_SCREEN_CAPTURE)
+    // Collect pixels of previous frames captures, encoding happens on background thread
+    screenCaptureFrame++;
+    UpdateScreenCaptures(false);
+
+    if (screenshotRequested)
+    {
+        RequestScreenCapture(SCREEN_CAPTURE_SCREENSHOT, TextFormat("%s/screenshot%03i.png", CORE.Storage.basePath, screenshotCounter), 0);
+        screenshotCounter++;
+        screenshotRequested = false;
+    }
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING) && defined(SUPPORT_SCREEN_CAPTURE)
     // Draw record indicator
     if (gifRecording)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
         gifFrameCounter += (unsigned int)(GetFrameTime()*1000);
 
         // NOTE: We record one gif frame depending on the desired gif framerate
         if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
-            #endif
-
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
+            // Start reading current frame pixels (from backbuffer), added to the gif recording a few frames later
+            // NOTE: Frame delay is given in centiseconds
+            RequestScreenCapture(SCREEN_CAPTURE_GIF_FRAME, NULL, gifFrameCounter/10);
             gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
-
-            RL_FREE(screenData);    // Free image data
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -955,6 +1065,16 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+    // Frame deadline missed, by the frame work itself or by waking up late
+    if (CORE.Time.target > 0.0)
+    {
+        double lateness = CORE.Time.frame - CORE.Time.target;
+
+        CORE.Time.pacedFrames++;
+        if (lateness > FRAME_PACING_TOLERANCE) CORE.Time.missedFrames++;
+        if (lateness > CORE.Time.maxLateness) CORE.Time.maxLateness = lateness;
+    }
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -968,12 +1088,9 @@ void EndDrawing(void)
             {
                 gifRecording = false;
 
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+                // Pending frames are added before the recording is saved on background thread
+                UpdateScreenCaptures(true);
+                RunScreenCaptureTask(SCREEN_CAPTURE_GIF_END, NULL, 0, 0, 0, TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
             }
             else
             {
@@ -981,7 +1098,7 @@ void EndDrawing(void)
                 gifFrameCounter = 0;
 
                 Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                RunScreenCaptureTask(SCREEN_CAPTURE_GIF_BEGIN, NULL, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 0, NULL);
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -990,12 +1107,13 @@ void EndDrawing(void)
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-            screenshotCounter++;
+            screenshotRequested = true;     // Captured on next frame, before swapping buffers
         }
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+    ResetFrameMemory();     // Release frame memory allocations (MemAllocFrame(), TextFormat() strings)
+
     CORE.Time.frameCounter++;
 }
 
@@ -1647,6 +1765,10 @@ void SetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+    CORE.Time.pacedFrames = 0;
+    CORE.Time.missedFrames = 0;
+    CORE.Time.maxLateness = 0.0;
+
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
@@ -1699,6 +1821,23 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get frame pacing stats (missed frames)
+// NOTE: Frames are paced by EndDrawing() while a target FPS is set, stats are reset by SetTargetFPS()
+FramePacingStats GetFramePacingStats(void)
+{
+    FramePacingStats stats = { 0 };
+
+    stats.frameCount = CORE.Time.pacedFrames;
+    stats.missedCount = CORE.Time.missedFrames;
+    if (stats.frameCount > 0) stats.missRate = (float)stats.missedCount/(float)stats.frameCount;
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+    stats.spinMargin = (float)spinMargin;
+#endif
+    stats.maxLateness = (float)CORE.Time.maxLateness;
+
+    return stats;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1724,16 +1863,38 @@ void WaitTime(double seconds)
     while (GetTime() < destinationTime) { }
 #else
     #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
+        // NOTE: We reserve the time usually needed from wake up to destination time for busy waiting,
+        // up to a percentage of the time, a longer busy wait is more likely to be preempted
+        double margin = (spinMargin < seconds*WAIT_SPIN_MARGIN_RATIO)? spinMargin : seconds*WAIT_SPIN_MARGIN_RATIO;
+        double sleepSeconds = seconds - margin;
+        double wakeTime = destinationTime - margin;
+        double overshoot = 0.0;
     #else
         double sleepSeconds = seconds;
     #endif
 
     // System halt functions
+    if (sleepSeconds > 0.0)
+    {
     #if defined(_WIN32)
         Sleep((unsigned long)(sleepSeconds*1000.0));
     #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    #if defined(__linux__) || defined(__FreeBSD__)
+        struct timespec req = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &req);
+        time_t sec = sleepSeconds;
+        req.tv_sec += sec;
+        req.tv_nsec += (long)((sleepSeconds - sec)*1000000000.0);
+        if (req.tv_nsec >= 1000000000L)
+        {
+            req.tv_sec++;
+            req.tv_nsec -= 1000000000L;
+        }
+
+        // NOTE: Sleep until an absolute time, an interrupted sleep is resumed without drifting
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &req, NULL) == EINTR) continue;
+    #endif
+    #if defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
         struct timespec req = { 0 };
         time_t sec = sleepSeconds;
         long nsec = (sleepSeconds - sec)*1000000000L;
@@ -1748,7 +1909,16 @@ void WaitTime(double seconds)
     #endif
 
     #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        overshoot = GetTime() - wakeTime;
+    #endif
+    }
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        // NOTE: CPU is not yielded while busy waiting, the thread could be scheduled back late
         while (GetTime() < destinationTime) { }
+
+        // Spin margin learns the lateness from wake up time: sleep overshoot and being preempted while busy waiting
+        if (sleepSeconds > 0.0) UpdateSpinMargin(overshoot + (GetTime() - destinationTime));
     #endif
 #endif
 }
@@ -1884,6 +2054,31 @@ void SetConfigFlags(unsigned int flags)
     CORE.Window.flags |= flags;
 }
 
+// Log memory usage by subsystem (CPU allocations and GPU resources)
+// NOTE: CPU allocations require SUPPORT_MEMORY_TRACKING, GPU resources sizes are estimated by rlgl
+void TraceMemoryStats(void)
+{
+#if defined(SUPPORT_MEMORY_TRACKING)
+    TRACELOG(LOG_INFO, "MEMORY: CPU allocations by subsystem:");
+
+    for (int tag = 0; tag <= MEMORY_TAG_ALL; tag++)
+    {
+        MemoryStats stats = GetMemoryStats(tag);
+
+        TRACELOG(LOG_INFO, "    > %-8s | live: %8lli KB (%6u allocs) | peak: %8lli KB | total: %10lli KB (%8u allocs)", GetMemoryTagName(tag),
+            stats.liveBytes/1024, stats.liveCount, stats.peakBytes/1024, stats.totalBytes/1024, stats.totalCount);
+    }
+#else
+    TRACELOG(LOG_INFO, "MEMORY: CPU allocations not tracked (SUPPORT_MEMORY_TRACKING)");
+#endif
+
+    FrameMemoryStats frame = GetFrameMemoryStats();
+    rlGpuMemoryStats gpu = rlGetGpuMemoryStats();
+
+    TRACELOG(LOG_INFO, "MEMORY: Frame memory: %u KB (peak: %u KB, overflows: %u)", frame.capacity/1024, frame.peak/1024, frame.overflows);
+    TRACELOG(LOG_INFO, "MEMORY: GPU textures: %i (%lli KB), buffers: %i (%lli KB)", gpu.textureCount, gpu.textureBytes/1024, gpu.bufferCount, gpu.bufferBytes/1024);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: File system
 //----------------------------------------------------------------------------------
@@ -3638,6 +3833,207 @@ void SetupFramebuffer(int width, int height)
     }
 }
 
+#if defined(SUPPORT_SCREEN_CAPTURE)
+// Start reading screen pixels into a pixel buffer, collected SCREEN_CAPTURE_LATENCY frames later
+// NOTE: If pixel buffers are not supported, pixels are read synchronously
+static void RequestScreenCapture(ScreenCaptureType type, const char *fileName, int delay)
+{
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+
+    ScreenCapture *capture = NULL;
+    ScreenCapture *oldest = &screenCaptures[0];
+
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        if (screenCaptures[i].type == SCREEN_CAPTURE_NONE) { capture = &screenCaptures[i]; break; }
+        if ((screenCaptureFrame - screenCaptures[i].frame) > (screenCaptureFrame - oldest->frame)) oldest = &screenCaptures[i];
+    }
+
+    // All pixel buffers in flight, wait for the oldest one
+    if (capture == NULL)
+    {
+        CollectScreenCapture(oldest);
+        capture = oldest;
+    }
+
+    capture->type = type;
+    capture->width = width;
+    capture->height = height;
+    capture->delay = delay;
+    capture->frame = screenCaptureFrame;
+    if (fileName != NULL) strncpy(capture->fileName, fileName, sizeof(capture->fileName) - 1);
+    else capture->fileName[0] = '\0';
+
+    // Pixel buffers are reallocated on screen size change
+    if (capture->bufferSize != width*height*4)
+    {
+        if (capture->pixelBuffer != 0) rlUnloadPixelBuffer(capture->pixelBuffer);
+        capture->pixelBuffer = rlLoadPixelBuffer(width*height*4);
+        capture->bufferSize = width*height*4;
+    }
+
+    if (capture->pixelBuffer != 0) rlReadScreenPixelsAsync(capture->pixelBuffer, width, height);
+    else CollectScreenCapture(capture);
+}
+
+// Read captured pixels and queue them for encoding on background thread
+static void CollectScreenCapture(ScreenCapture *capture)
+{
+    unsigned char *pixels = NULL;
+
+    if (capture->pixelBuffer != 0)
+    {
+        unsigned char *data = rlMapPixelBuffer(capture->pixelBuffer, capture->bufferSize);
+
+        if (data != NULL)
+        {
+            int rowSize = capture->width*4;
+            pixels = (unsigned char *)RL_MALLOC(capture->bufferSize);
+
+            // Flip image vertically, framebuffer origin is the bottom left corner
+            for (int y = 0; y < capture->height; y++) memcpy(pixels + y*rowSize, data + (capture->height - 1 - y)*rowSize, rowSize);
+
+            rlUnmapPixelBuffer();
+        }
+    }
+    else pixels = rlReadScreenPixels(capture->width, capture->height);
+
+    if (pixels != NULL) RunScreenCaptureTask(capture->type, pixels, capture->width, capture->height, capture->delay, capture->fileName);
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to read screen capture pixels");
+
+    capture->type = SCREEN_CAPTURE_NONE;
+}
+
+// Collect screen captures read at least SCREEN_CAPTURE_LATENCY frames ago, or all of them if flush
+// NOTE: Captures are collected in capture order, gif frames must be encoded in order
+static void UpdateScreenCaptures(bool flush)
+{
+    while (true)
+    {
+        ScreenCapture *oldest = NULL;
+
+        for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+        {
+            if (screenCaptures[i].type == SCREEN_CAPTURE_NONE) continue;
+            if ((oldest == NULL) || ((screenCaptureFrame - screenCaptures[i].frame) > (screenCaptureFrame - oldest->frame))) oldest = &screenCaptures[i];
+        }
+
+        if ((oldest == NULL) || (!flush && ((screenCaptureFrame - oldest->frame) < SCREEN_CAPTURE_LATENCY))) break;
+
+        CollectScreenCapture(oldest);
+    }
+}
+
+// Unload screen captures pixel buffers
+static void UnloadScreenCaptures(void)
+{
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        if (screenCaptures[i].pixelBuffer != 0) rlUnloadPixelBuffer(screenCaptures[i].pixelBuffer);
+    }
+
+    memset(screenCaptures, 0, sizeof(screenCaptures));
+}
+
+// Queue screen capture encoding task, pixels ownership is transferred to the task
+static void RunScreenCaptureTask(ScreenCaptureType type, unsigned char *pixels, int width, int height, int delay, const char *fileName)
+{
+    ScreenCaptureTask *task = (ScreenCaptureTask *)RL_CALLOC(1, sizeof(ScreenCaptureTask));
+
+    task->type = type;
+    task->pixels = pixels;
+    task->width = width;
+    task->height = height;
+    task->delay = delay;
+    if (fileName != NULL) snprintf(task->fileName, sizeof(task->fileName), "%s", fileName);
+
+    RunWorkerTask(EncodeScreenCapture, task);
+}
+
+// Encode and save screen capture
+// NOTE: Runs on background thread, only thread-safe functions can be used (no TextFormat())
+static void EncodeScreenCapture(void *userData)
+{
+    ScreenCaptureTask *task = (ScreenCaptureTask *)userData;
+
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    if (task->pixels != NULL)
+    {
+        for (int i = 3; i < task->width*task->height*4; i += 4) task->pixels[i] = 255;
+    }
+
+    switch (task->type)
+    {
+        case SCREEN_CAPTURE_SCREENSHOT:
+        {
+        #if defined(SUPPORT_MODULE_RTEXTURES)
+            Image image = { task->pixels, task->width, task->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+            int dataSize = 0;
+            unsigned char *fileData = ExportImageToMemory(image, ".png", &dataSize);    // WARNING: Module required: rtextures
+
+            if ((fileData != NULL) && SaveFileData(task->fileName, fileData, dataSize)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", task->fileName);
+            else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", task->fileName);
+
+            RL_FREE(fileData);
+        #else
+            TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
+        #endif
+        } break;
+    #if defined(SUPPORT_GIF_RECORDING)
+        case SCREEN_CAPTURE_GIF_BEGIN: msf_gif_begin(&gifState, task->width, task->height); break;
+        case SCREEN_CAPTURE_GIF_FRAME: msf_gif_frame(&gifState, task->pixels, task->delay, GIF_RECORD_BITRATE, task->width*4); break;
+        case SCREEN_CAPTURE_GIF_END:
+        {
+            MsfGifResult result = msf_gif_end(&gifState);
+
+            if (task->fileName[0] != '\0')
+            {
+                SaveFileData(task->fileName, result.data, (unsigned int)result.dataSize);
+                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+            }
+
+            msf_gif_free(result);
+        } break;
+    #endif
+        default: break;
+    }
+
+    RL_FREE(task->pixels);
+    RL_FREE(task);
+}
+#endif  // SUPPORT_SCREEN_CAPTURE
+
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+// Add a wake up lateness sample and update spin margin
+// NOTE: Spin margin covers WAIT_OVERSHOOT_PERCENTILE of the last waits lateness from wake up time,
+// it grows when the system is loaded (late wake ups, preemption) and shrinks back when idle (less busy-wait)
+static void UpdateSpinMargin(double lateness)
+{
+    wakeLateness[wakeLatenessIndex] = lateness;
+    wakeLatenessIndex = (wakeLatenessIndex + 1)%WAIT_OVERSHOOT_SAMPLES;
+    if (wakeLatenessCount < WAIT_OVERSHOOT_SAMPLES) wakeLatenessCount++;
+
+    // Sort a copy of the samples (insertion sort, a few samples only)
+    double sorted[WAIT_OVERSHOOT_SAMPLES] = { 0 };
+
+    for (int i = 0; i < wakeLatenessCount; i++)
+    {
+        int j = i;
+        for (; (j > 0) && (sorted[j - 1] > wakeLateness[i]); j--) sorted[j] = sorted[j - 1];
+        sorted[j] = wakeLateness[i];
+    }
+
+    spinMargin = sorted[(int)(WAIT_OVERSHOOT_PERCENTILE*(wakeLatenessCount - 1) + 0.5)];
+
+    if (spinMargin < WAIT_SPIN_MARGIN_MIN) spinMargin = WAIT_SPIN_MARGIN_MIN;
+    else if (spinMargin > WAIT_SPIN_MARGIN_MAX) spinMargin = WAIT_SPIN_MARGIN_MAX;
+}
+#endif
+
 // Scan all files and directories in a base path
 // WARNING: files.paths[] must be previously allocated and
 // contain enough space to store all required paths
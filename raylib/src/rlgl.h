@@ -422,6 +422,15 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// GPU memory usage, estimated from loaded resources sizes
+// NOTE: Drivers could pad or keep extra copies of resources, depth renderbuffers are not included
+typedef struct rlGpuMemoryStats {
+    int textureCount;           // Textures loaded (including cubemaps and depth textures)
+    int bufferCount;            // Buffers loaded (vertex, index, pixel and shader storage buffers)
+    long long textureBytes;     // Textures size in bytes (including mipmaps)
+    long long bufferBytes;      // Buffers size in bytes
+} rlGpuMemoryStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -715,6 +724,7 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI rlGpuMemoryStats rlGetGpuMemoryStats(void);       // Get GPU memory usage, estimated from loaded textures and buffers
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -758,6 +768,13 @@ RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int forma
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
 
+// Pixel buffers management (pbo), asynchronous screen pixels readback
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel pack buffer (returns 0 if not supported)
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel pack buffer
+RLAPI void rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Start reading screen pixel data into pixel buffer, returns without waiting
+RLAPI unsigned char *rlMapPixelBuffer(unsigned int id, int size);         // Map pixel buffer data for reading (flipped vertically, waits for pending read)
+RLAPI void rlUnmapPixelBuffer(void);                                      // Unmap pixel buffer mapped with rlMapPixelBuffer()
+
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
 RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel); // Attach texture/renderbuffer to a framebuffer
@@ -885,7 +902,7 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -1105,6 +1122,13 @@ typedef struct rlglData {
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        unsigned int *textureSizes;         // Loaded textures size in bytes, indexed by texture id
+        unsigned int *bufferSizes;          // Loaded buffers size in bytes, indexed by buffer id
+        unsigned int textureIdCapacity;     // Texture sizes array capacity
+        unsigned int bufferIdCapacity;      // Buffer sizes array capacity
+        rlGpuMemoryStats stats;             // Loaded resources counters
+    } Memory;           // GPU memory accounting
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1145,6 +1169,12 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int rlGetTextureDataSize(int width, int height, int format, int mipmapCount); // Get texture data size in bytes, including mipmaps
+static void rlSetGpuMemorySize(unsigned int **sizes, unsigned int *capacity, unsigned int id, unsigned int size, int *count, long long *bytes); // Set GPU resource size (0 on unload)
+static void rlSetTextureMemorySize(unsigned int id, unsigned int size); // Set texture size for GPU memory accounting (0 on unload)
+static void rlSetBufferMemorySize(unsigned int id, unsigned int size);  // Set buffer size for GPU memory accounting (0 on unload)
+#endif
 
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
@@ -2332,8 +2362,12 @@ void rlglClose(void)
 
     rlUnloadShaderDefault();          // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlUnloadTexture(RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+    RL_FREE(RLGL.Memory.textureSizes);
+    RL_FREE(RLGL.Memory.bufferSizes);
+    memset(&RLGL.Memory, 0, sizeof(RLGL.Memory));
 #endif
 }
 
@@ -2687,6 +2721,16 @@ int rlGetFramebufferHeight(void)
     return height;
 }
 
+// Get GPU memory usage, estimated from loaded textures and buffers
+rlGpuMemoryStats rlGetGpuMemoryStats(void)
+{
+    rlGpuMemoryStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Memory.stats;
+#endif
+    return stats;
+}
+
 // Get default internal texture (white texture)
 // NOTE: Default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
 unsigned int rlGetTextureIdDefault(void)
@@ -2820,6 +2864,12 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+
+        rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[0], bufferElements*3*4*sizeof(float));
+        rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[1], bufferElements*2*4*sizeof(float));
+        rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[2], bufferElements*3*4*sizeof(float));
+        rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[3], bufferElements*4*4*sizeof(unsigned char));
+        rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[4], bufferElements*6*sizeof(batch.vertexBuffer[i].indices[0]));
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
@@ -2876,6 +2926,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         }
 
         // Delete VBOs from GPU (VRAM)
+        for (int j = 0; j < 5; j++) rlSetBufferMemorySize(batch.vertexBuffer[i].vboId[j], 0);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
@@ -3320,6 +3371,10 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // Unbind current texture
     glBindTexture(GL_TEXTURE_2D, 0);
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0) rlSetTextureMemorySize(id, rlGetTextureDataSize(width, height, format, mipmapCount));
+#endif
+
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
 
@@ -3364,6 +3419,8 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         glBindTexture(GL_TEXTURE_2D, 0);
 
+        rlSetTextureMemorySize(id, width*height*((RLGL.ExtSupported.maxDepthBits > 16)? 4 : 2));
+
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
     else
@@ -3472,6 +3529,8 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 #endif
 
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+
+    if (id > 0) rlSetTextureMemorySize(id, 6*rlGetTextureDataSize(size, size, format, mipmapCount));
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3573,6 +3632,10 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSetTextureMemorySize(id, 0);
+#endif
 }
 
 // Generate mipmap data for selected texture
@@ -3597,6 +3660,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
         #define MAX(a,b) (((a)>(b))? (a):(b))
 
         *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        rlSetTextureMemorySize(id, rlGetTextureDataSize(width, height, format, *mipmaps));
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
@@ -3683,23 +3747,82 @@ unsigned char *rlReadScreenPixels(int width, int height)
     // Flip image vertically!
     unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
 
-    for (int y = height - 1; y >= 0; y--)
-    {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+    for (int y = 0; y < height; y++) memcpy(imgData + ((height - 1) - y)*width*4, screenData + y*width*4, width*4);  // Flip line
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
-        }
-    }
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int i = 3; i < width*height*4; i += 4) imgData[i] = 255;
 
     RL_FREE(screenData);
 
     return imgData;     // NOTE: image data should be freed
 }
 
+// Pixel buffers management (pbo)
+//-----------------------------------------------------------------------------------------
+// Load pixel pack buffer, screen pixels are read into it without stalling the pipeline
+// NOTE: Requires OpenGL 3.3 or OpenGL ES 3.0, returns 0 if not supported
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    rlSetBufferMemorySize(id, size);
+
+    if (id > 0) TRACELOGD("PBO: [ID %i] Pixel buffer loaded successfully (%i bytes)", id, size);
+#endif
+
+    return id;
+}
+
+// Unload pixel pack buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glDeleteBuffers(1, &id);
+    rlSetBufferMemorySize(id, 0);
+#endif
+}
+
+// Start reading screen pixels into a pixel buffer
+// NOTE: The copy happens on the GPU, the buffer should be mapped a few frames later to avoid waiting for it
+void rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Map pixel buffer data for reading
+// NOTE: Data is flipped vertically, same as glReadPixels(), and only valid until rlUnmapPixelBuffer()
+unsigned char *rlMapPixelBuffer(unsigned int id, int size)
+{
+    unsigned char *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (data == NULL) glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return data;
+}
+
+// Unmap pixel buffer mapped with rlMapPixelBuffer()
+void rlUnmapPixelBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3807,7 +3930,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE)
+    {
+        glDeleteTextures(1, &depthIdU);
+        rlSetTextureMemorySize(depthIdU, 0);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
@@ -3830,6 +3957,7 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlSetBufferMemorySize(id, size);
 #endif
 
     return id;
@@ -3844,6 +3972,7 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     glGenBuffers(1, &id);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlSetBufferMemorySize(id, size);
 #endif
 
     return id;
@@ -4051,6 +4180,7 @@ void rlUnloadVertexBuffer(unsigned int vboId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteBuffers(1, &vboId);
+    rlSetBufferMemorySize(vboId, 0);
     //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
 #endif
 }
@@ -4479,6 +4609,7 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
     glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
     if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    rlSetBufferMemorySize(ssbo, size);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
@@ -4491,6 +4622,7 @@ void rlUnloadShaderBuffer(unsigned int ssboId)
 {
 #if defined(GRAPHICS_API_OPENGL_43)
     glDeleteBuffers(1, &ssboId);
+    rlSetBufferMemorySize(ssboId, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
@@ -5121,6 +5253,76 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get texture data size in bytes, including mipmaps
+static unsigned int rlGetTextureDataSize(int width, int height, int format, int mipmapCount)
+{
+    unsigned int dataSize = 0;
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        dataSize += rlGetPixelDataSize(width, height, format);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return dataSize;
+}
+
+// Set GPU resource size (0 on unload)
+// NOTE: Sizes array is indexed by OpenGL object id, ids are small and reused once objects are deleted
+static void rlSetGpuMemorySize(unsigned int **sizes, unsigned int *capacity, unsigned int id, unsigned int size, int *count, long long *bytes)
+{
+    if (id == 0) return;
+
+    if (id >= *capacity)
+    {
+        if (size == 0) return;      // Never loaded (not tracked)
+
+        unsigned int newCapacity = (*capacity > 0)? *capacity : 256;
+        while (newCapacity <= id) newCapacity *= 2;
+
+        unsigned int *newSizes = (unsigned int *)RL_REALLOC(*sizes, newCapacity*sizeof(unsigned int));
+        if (newSizes == NULL) return;
+
+        memset(newSizes + *capacity, 0, (newCapacity - *capacity)*sizeof(unsigned int));
+        *sizes = newSizes;
+        *capacity = newCapacity;
+    }
+
+    unsigned int *current = &(*sizes)[id];
+
+    if (*current > 0)
+    {
+        (*count)--;
+        *bytes -= *current;
+    }
+
+    if (size > 0)
+    {
+        (*count)++;
+        *bytes += size;
+    }
+
+    *current = size;
+}
+
+// Set texture size for GPU memory accounting (0 on unload)
+static void rlSetTextureMemorySize(unsigned int id, unsigned int size)
+{
+    rlSetGpuMemorySize(&RLGL.Memory.textureSizes, &RLGL.Memory.textureIdCapacity, id, size, &RLGL.Memory.stats.textureCount, &RLGL.Memory.stats.textureBytes);
+}
+
+// Set buffer size for GPU memory accounting (0 on unload)
+static void rlSetBufferMemorySize(unsigned int id, unsigned int size)
+{
+    rlSetGpuMemorySize(&RLGL.Memory.bufferSizes, &RLGL.Memory.bufferIdCapacity, id, size, &RLGL.Memory.stats.bufferCount, &RLGL.Memory.stats.bufferBytes);
+}
+#endif
+
 // Auxiliar math functions
 
 // Get float array of matrix data
@@ -18,6 +18,11 @@
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_MESH_OPTIMIZATION
+*           Optimize loaded and par_shapes generated meshes before GPU upload: vertices are welded
+*           into an index buffer and triangles/vertices reordered for post-transform cache,
+*           overdraw and vertex fetch efficiency [OptimizeMesh()]
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +54,13 @@
 
 #if defined(SUPPORT_MODULE_RMODELS)
 
+#define RL_MEMORY_TAG MEMORY_TAG_MODELS     // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: TRACELOG(), LoadFileData(), LoadFileText(), SaveFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
 
 #include <stdio.h>          // Required for: sprintf()
-#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <stdlib.h>         // Required for: malloc(), calloc(), free(), qsort()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
 
@@ -132,16 +138,70 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_VERTEX_CACHE_SIZE
+    #define MESH_VERTEX_CACHE_SIZE  16    // Post-transform vertex cache size (FIFO) used to measure ACMR
+#endif
+
+#ifndef MAX_ANIMATION_POSE_CACHE
+    #define MAX_ANIMATION_POSE_CACHE 32   // Maximum animation poses (bone matrices) cached
+#endif
+#ifndef ANIMATION_POSE_BLEND_STEPS
+    #define ANIMATION_POSE_BLEND_STEPS 16 // Interpolation steps between two animation frames (cached poses key)
+#endif
+
+#define MESH_OPTIMIZE_CACHE_SIZE    32    // Post-transform vertex cache size (LRU) used to optimize triangles order
+#define MESH_MAX_VERTEX_STREAMS     10    // Maximum mesh per-vertex attribute streams
+#define MESH_SKINNING_BATCH_SIZE  2048    // Vertices processed per skinning job batch (worker threads)
+#define MAX_MESH_SKINNING_STATES    64    // Maximum skinned meshes tracked to skip unchanged poses
+#define RAY_COLLISION_MESH_VERTICES 1024  // Indexed mesh vertices transformed once on the stack by GetRayCollisionMesh()
+#define RAY_COLLISION_MESH_CHUNK    64    // Triangles transformed together on the stack by GetRayCollisionMesh(), larger meshes
+
+#if defined(RAYMATH_SIMD_AVX2) || defined(RAYMATH_SIMD_SSE2)
+    #define MESH_SKINNING_SIMD_SSE        // Skinning uses 128bit SSE vectors, one matrix column per vector
+#elif defined(RAYMATH_SIMD_NEON)
+    #define MESH_SKINNING_SIMD_NEON
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh skinning job, shared by all threads skinning the mesh
+typedef struct MeshSkinningJob {
+    const Mesh *mesh;               // Mesh to skin, animVertices and animNormals are updated
+    const float *boneColumns;       // Bone matrices as 4 columns of 4 floats (x, y, z, 0)
+} MeshSkinningJob;
+
+// Mesh skinning state, used to skip meshes whose bone matrices did not change
+typedef struct MeshSkinningState {
+    const float *animVertices;      // Mesh identifier (animated vertex data pointer)
+    unsigned long long posesHash;   // Hash of bone matrices used on last skinning
+} MeshSkinningState;
+
+// Animation pose, bone matrices for an animation frame relative to a model bind pose
+// NOTE: Poses are shared by all models with same bind pose playing same animation frame
+typedef struct AnimationPose {
+    Transform **framePoses;         // Animation identifier (frame poses data pointer)
+    Transform *bindPose;            // Model identifier (bind pose data pointer)
+    int frame;                      // Animation frame index, in range [0, frameCount)
+    int blend;                      // Interpolation step with next frame, in range [0, ANIMATION_POSE_BLEND_STEPS)
+    int boneCount;                  // Number of bone matrices
+    Matrix *boneMatrices;           // Bone matrices
+    unsigned int lastUsed;          // Last use counter, least recently used pose is replaced
+} AnimationPose;
+
+// Mesh triangles cluster, consecutive triangles of cache optimized sequence (overdraw optimization)
+typedef struct MeshCluster {
+    int start;                      // First index of cluster, clusters are created in increasing order
+    int count;                      // Number of indices on cluster
+    float sortKey;                  // Outwards facing measure, higher values are drawn first
+} MeshCluster;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static AnimationPose poseCache[MAX_ANIMATION_POSE_CACHE] = { 0 };           // Animation poses cache
+static unsigned int poseCacheCounter = 0;                                   // Animation poses use counter
+static MeshSkinningState skinningStates[MAX_MESH_SKINNING_STATES] = { 0 };   // Skinned meshes states
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -168,6 +228,19 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
 
+static int GetMeshVertexStreams(Mesh *mesh, unsigned char ***streams, int *sizes);  // Get mesh per-vertex attribute streams
+static void RemapMeshVertexStreams(Mesh *mesh, const int *newVertex, int newVertexCount);  // Reorder mesh vertex attributes
+static bool WeldMeshVertices(Mesh *mesh);                                       // Weld equal vertices, generating index buffer
+static void OptimizeIndicesVertexCache(unsigned short *indices, int indexCount, int vertexCount);  // Reorder triangles for vertex cache
+static void OptimizeIndicesOverdraw(unsigned short *indices, int indexCount, const float *vertices, int vertexCount);  // Reorder triangles for overdraw
+static int CompareMeshClusters(const void *a, const void *b);                  // Compare clusters by key (descending) and start (qsort() callback)
+static void OptimizeMeshVertexFetch(Mesh *mesh);                                // Reorder vertices for vertex fetch
+
+static const Matrix *GetAnimationPose(Model model, ModelAnimation anim, float frame);    // Get bone matrices for animation frame (cached)
+static void UnloadAnimationPoses(const void *framePoses, const void *bindPose);        // Unload cached poses for animation or model
+static bool UpdateMeshSkinningState(Mesh mesh);                                 // Check if mesh bone matrices changed since last skinning
+static void SkinMeshVertices(void *userData, int start, int end);               // Skin mesh vertex range (worker job callback)
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1112,8 +1185,15 @@ Model LoadModel(const char *fileName)
 
     if ((model.meshCount != 0) && (model.meshes != NULL))
     {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        for (int i = 0; i < model.meshCount; i++)
+        {
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+            // Weld vertices and reorder triangles before upload, loaders provide data in file order
+            OptimizeMesh(&model.meshes[i]);
+#endif
+            // Upload vertex data to GPU (static meshes)
+            UploadMesh(&model.meshes[i], false);
+        }
     }
     else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
 
@@ -1207,6 +1287,7 @@ void UnloadModel(Model model)
     RL_FREE(model.meshMaterial);
 
     // Unload animation data
+    UnloadAnimationPoses(NULL, model.bindPose);
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
 
@@ -1719,8 +1800,10 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
+    // Create instances buffer, from frame memory if available (only required until uploaded)
+    instanceTransforms = (float16 *)MemAllocFrame(instances*sizeof(float16));
+    bool transformsAllocated = (instanceTransforms == NULL);
+    if (transformsAllocated) instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
 
     // Fill buffer with instances transformations as float16 arrays
     for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
@@ -1907,7 +1990,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Remove instance transforms buffer
     rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    if (transformsAllocated) RL_FREE(instanceTransforms);
 #endif
 }
 
@@ -1928,6 +2011,12 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.texcoords2);
     RL_FREE(mesh.indices);
 
+    // Forget mesh skinning state, animated vertex data pointer could be reused
+    for (int i = 0; i < MAX_MESH_SKINNING_STATES; i++)
+    {
+        if ((mesh.animVertices != NULL) && (skinningStates[i].animVertices == mesh.animVertices)) skinningStates[i] = (MeshSkinningState){ 0 };
+    }
+
     RL_FREE(mesh.animVertices);
     RL_FREE(mesh.animNormals);
     RL_FREE(mesh.boneWeights);
@@ -2262,14 +2351,131 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
     return animations;
 }
 
+// Get bone matrices for an animation frame, interpolating between frames
+// NOTE: Poses are cached by animation, model bind pose, frame index and interpolation step, so models playing
+// the same animation frame reuse them, cache is invalidated when animation or model is unloaded
+// NOTE: Interpolation is quantized to ANIMATION_POSE_BLEND_STEPS, time-driven fractional frames hit the cache
+static const Matrix *GetAnimationPose(Model model, ModelAnimation anim, float frame)
+{
+    // Wrap frame into [0, frameCount)
+    frame = fmodf(frame, (float)anim.frameCount);
+    if (frame < 0.0f) frame += (float)anim.frameCount;
+
+    int frame0 = (int)frame;
+    int blend = (int)((frame - (float)frame0)*ANIMATION_POSE_BLEND_STEPS + 0.5f);
+
+    if (blend >= ANIMATION_POSE_BLEND_STEPS)
+    {
+        frame0 = (frame0 + 1)%anim.frameCount;
+        blend = 0;
+    }
+    if (frame0 >= anim.frameCount) frame0 = 0;  // Float rounding of fmodf() near frameCount
+
+    poseCacheCounter++;
+
+    int slot = 0;
+
+    for (int i = 0; i < MAX_ANIMATION_POSE_CACHE; i++)
+    {
+        AnimationPose *pose = &poseCache[i];
+
+        if ((pose->framePoses == anim.framePoses) && (pose->bindPose == model.bindPose) &&
+            (pose->frame == frame0) && (pose->blend == blend) && (pose->boneCount == anim.boneCount))
+        {
+            pose->lastUsed = poseCacheCounter;
+            return pose->boneMatrices;
+        }
+
+        if (pose->lastUsed < poseCache[slot].lastUsed) slot = i;
+    }
+
+    // Pose not cached, replace least recently used one
+    AnimationPose *pose = &poseCache[slot];
+
+    if (pose->boneCount != anim.boneCount)
+    {
+        RL_FREE(pose->boneMatrices);
+        pose->boneMatrices = (Matrix *)RL_MALLOC(anim.boneCount*sizeof(Matrix));
+    }
+
+    pose->framePoses = anim.framePoses;
+    pose->bindPose = model.bindPose;
+    pose->frame = frame0;
+    pose->blend = blend;
+    pose->boneCount = anim.boneCount;
+    pose->lastUsed = poseCacheCounter;
+
+    int frame1 = (frame0 + 1)%anim.frameCount;
+    float amount = (float)blend/ANIMATION_POSE_BLEND_STEPS;
+
+    for (int boneId = 0; boneId < anim.boneCount; boneId++)
+    {
+        Vector3 inTranslation = model.bindPose[boneId].translation;
+        Quaternion inRotation = model.bindPose[boneId].rotation;
+        Vector3 inScale = model.bindPose[boneId].scale;
+
+        Vector3 outTranslation = anim.framePoses[frame0][boneId].translation;
+        Quaternion outRotation = anim.framePoses[frame0][boneId].rotation;
+        Vector3 outScale = anim.framePoses[frame0][boneId].scale;
+
+        if (amount > 0.0f)
+        {
+            outTranslation = Vector3Lerp(outTranslation, anim.framePoses[frame1][boneId].translation, amount);
+            outRotation = QuaternionSlerp(outRotation, anim.framePoses[frame1][boneId].rotation, amount);
+            outScale = Vector3Lerp(outScale, anim.framePoses[frame1][boneId].scale, amount);
+        }
+
+        Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
+        Quaternion invRotation = QuaternionInvert(inRotation);
+        Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+        Vector3 boneTranslation = Vector3Add(
+            Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
+            outRotation), outTranslation);
+        Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
+        Vector3 boneScale = Vector3Multiply(outScale, invScale);
+
+        Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
+            QuaternionToMatrix(boneRotation),
+            MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+            MatrixScale(boneScale.x, boneScale.y, boneScale.z));
+
+        pose->boneMatrices[boneId] = boneMatrix;
+    }
+
+    return pose->boneMatrices;
+}
+
+// Unload cached animation poses for an animation (framePoses) or a model (bindPose)
+static void UnloadAnimationPoses(const void *framePoses, const void *bindPose)
+{
+    for (int i = 0; i < MAX_ANIMATION_POSE_CACHE; i++)
+    {
+        if (((framePoses != NULL) && (poseCache[i].framePoses == framePoses)) ||
+            ((bindPose != NULL) && (poseCache[i].bindPose == bindPose)))
+        {
+            RL_FREE(poseCache[i].boneMatrices);
+            poseCache[i] = (AnimationPose){ 0 };
+        }
+    }
+}
+
 // Update model animated bones transform matrices for a given frame
 // NOTE: Updated data is not uploaded to GPU but kept at model.meshes[i].boneMatrices[boneId],
 // to be uploaded to shader at drawing, in case GPU skinning is enabled
 void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
+{
+    UpdateModelAnimationBonesEx(model, anim, (float)frame);
+}
+
+// Update model animation mesh bone matrices, interpolating between frames
+// NOTE: Frame can be fractional, bone transforms are interpolated with next frame (wrapping to first one)
+// in ANIMATION_POSE_BLEND_STEPS steps
+void UpdateModelAnimationBonesEx(Model model, ModelAnimation anim, float frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+        const Matrix *boneMatrices = GetAnimationPose(model, anim, frame);
 
         for (int i = 0; i < model.meshCount; i++)
         {
@@ -2277,95 +2483,56 @@ void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
             {
                 assert(model.meshes[i].boneCount == anim.boneCount);
 
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    Vector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    Vector3 inScale = model.bindPose[boneId].scale;
-
-                    Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    Vector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
-                    Quaternion invRotation = QuaternionInvert(inRotation);
-                    Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    Vector3 boneTranslation = Vector3Add(
-                        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-                    Vector3 boneScale = Vector3Multiply(outScale, invScale);
-
-                    Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                        QuaternionToMatrix(boneRotation),
-                        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
+                memcpy(model.meshes[i].boneMatrices, boneMatrices, model.meshes[i].boneCount*sizeof(Matrix));
             }
         }
     }
 }
 
-// at least 2x speed up vs the old method 
 // Update model animated vertex data (positions and normals) for a given frame
+// NOTE: Every vertex is skinned with the weighted sum of its bone matrices, large meshes are split
+// across worker threads and meshes with the same bone matrices than last update are skipped
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    UpdateModelAnimationBones(model,anim,frame);
+    UpdateModelAnimationEx(model, anim, (float)frame);
+}
+
+// Update model animated vertex data (positions and normals), interpolating between frames
+void UpdateModelAnimationEx(Model model, ModelAnimation anim, float frame)
+{
+    UpdateModelAnimationBonesEx(model, anim, frame);
+
     for (int m = 0; m < model.meshCount; m++)
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-        {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x * boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y * boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z * boneWeight;
-                updated = true;
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
-        }
-        if (updated)
+        Mesh *mesh = &model.meshes[m];
+
+        if ((mesh->boneMatrices == NULL) || (mesh->boneWeights == NULL) || (mesh->boneIds == NULL) || (mesh->animVertices == NULL)) continue;
+
+        // Bone matrices unchanged, animated vertex data is already up to date
+        if (!UpdateMeshSkinningState(*mesh)) continue;
+
+        // Transpose bone matrices to columns (x, y, z, 0), so weighted columns can be added as vectors
+        float *boneColumns = (float *)RL_MALLOC(mesh->boneCount*16*sizeof(float));
+
+        for (int b = 0; b < mesh->boneCount; b++)
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+            Matrix mat = mesh->boneMatrices[b];
+            float *col = boneColumns + b*16;
+
+            col[0] = mat.m0; col[1] = mat.m1; col[2] = mat.m2; col[3] = 0.0f;
+            col[4] = mat.m4; col[5] = mat.m5; col[6] = mat.m6; col[7] = 0.0f;
+            col[8] = mat.m8; col[9] = mat.m9; col[10] = mat.m10; col[11] = 0.0f;
+            col[12] = mat.m12; col[13] = mat.m13; col[14] = mat.m14; col[15] = 0.0f;
         }
+
+        MeshSkinningJob job = { mesh, boneColumns };
+        RunWorkerJob(SkinMeshVertices, &job, mesh->vertexCount, MESH_SKINNING_BATCH_SIZE);
+
+        RL_FREE(boneColumns);
+
+        rlUpdateVertexBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float), 0);     // Update vertex position
+        if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float), 0);    // Update vertex normals
     }
 }
 
@@ -2379,6 +2546,8 @@ void UnloadModelAnimations(ModelAnimation *animations, int animCount)
 // Unload animation data
 void UnloadModelAnimation(ModelAnimation anim)
 {
+    UnloadAnimationPoses(anim.framePoses, NULL);
+
     for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
 
     RL_FREE(anim.bones);
@@ -2806,6 +2975,11 @@ Mesh GenMeshSphere(float radius, int rings, int slices)
 
         par_shapes_free_mesh(sphere);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2850,6 +3024,11 @@ Mesh GenMeshHemiSphere(float radius, int rings, int slices)
 
         par_shapes_free_mesh(sphere);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2914,6 +3093,11 @@ Mesh GenMeshCylinder(float radius, float height, int slices)
 
         par_shapes_free_mesh(cylinder);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2969,6 +3153,11 @@ Mesh GenMeshCone(float radius, float height, int slices)
 
         par_shapes_free_mesh(cone);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -3015,6 +3204,11 @@ Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
 
         par_shapes_free_mesh(torus);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -3059,6 +3253,11 @@ Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
 
         par_shapes_free_mesh(knot);
 
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        // Weld shared vertices and reorder triangles for GPU post-transform cache
+        OptimizeMesh(&mesh);
+#endif
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -3556,16 +3755,9 @@ BoundingBox GetMeshBoundingBox(Mesh mesh)
     Vector3 minVertex = { 0 };
     Vector3 maxVertex = { 0 };
 
-    if (mesh.vertices != NULL)
+    if ((mesh.vertices != NULL) && (mesh.vertexCount > 0))
     {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
+        Vector3MinMaxArray((const Vector3 *)mesh.vertices, 3*sizeof(float), mesh.vertexCount, &minVertex, &maxVertex);
     }
 
     // Create the bounding box
@@ -3594,25 +3786,32 @@ void GenMeshTangents(Mesh *mesh)
         mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
     }
 
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    // NOTE: Tangents of vertices shared by several triangles (indexed meshes) are accumulated
+    Vector3 *tan1 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
+    Vector3 *tan2 = (Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(Vector3));
 
-    if (mesh->vertexCount % 3 != 0)
+    if ((mesh->indices == NULL) && (mesh->vertexCount % 3 != 0))
     {
         TRACELOG(LOG_WARNING, "MESH: vertexCount expected to be a multiple of 3. Expect uninitialized values.");
     }
 
-    for (int i = 0; i <= mesh->vertexCount - 3; i += 3)
+    int indexCount = (mesh->indices != NULL)? mesh->triangleCount*3 : mesh->vertexCount;
+
+    for (int t = 0; t <= indexCount - 3; t += 3)
     {
+        int i0 = (mesh->indices != NULL)? mesh->indices[t] : t;
+        int i1 = (mesh->indices != NULL)? mesh->indices[t + 1] : t + 1;
+        int i2 = (mesh->indices != NULL)? mesh->indices[t + 2] : t + 2;
+
         // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+        Vector3 v1 = { mesh->vertices[i0*3 + 0], mesh->vertices[i0*3 + 1], mesh->vertices[i0*3 + 2] };
+        Vector3 v2 = { mesh->vertices[i1*3 + 0], mesh->vertices[i1*3 + 1], mesh->vertices[i1*3 + 2] };
+        Vector3 v3 = { mesh->vertices[i2*3 + 0], mesh->vertices[i2*3 + 1], mesh->vertices[i2*3 + 2] };
 
         // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+        Vector2 uv1 = { mesh->texcoords[i0*2 + 0], mesh->texcoords[i0*2 + 1] };
+        Vector2 uv2 = { mesh->texcoords[i1*2 + 0], mesh->texcoords[i1*2 + 1] };
+        Vector2 uv3 = { mesh->texcoords[i2*2 + 0], mesh->texcoords[i2*2 + 1] };
 
         float x1 = v2.x - v1.x;
         float y1 = v2.y - v1.y;
@@ -3632,13 +3831,13 @@ void GenMeshTangents(Mesh *mesh)
         Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
         Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+        tan1[i0] = Vector3Add(tan1[i0], sdir);
+        tan1[i1] = Vector3Add(tan1[i1], sdir);
+        tan1[i2] = Vector3Add(tan1[i2], sdir);
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
+        tan2[i0] = Vector3Add(tan2[i0], tdir);
+        tan2[i1] = Vector3Add(tan2[i1], tdir);
+        tan2[i2] = Vector3Add(tan2[i2], tdir);
     }
 
     // Compute tangents considering normals
@@ -3689,6 +3888,90 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Optimize mesh for GPU rendering
+// NOTE: Vertices are welded into an index buffer (if not indexed), triangles are reordered
+// for post-transform vertex cache (Forsyth) and overdraw (clusters sorted outside-in),
+// vertices are finally reordered by first use for vertex fetch locality
+void OptimizeMesh(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->vertexCount < 3)) return;
+
+    if ((mesh->indices == NULL) && ((mesh->vertexCount%3) != 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization requires a triangles mesh, vertexCount should be a multiple of 3");
+        return;
+    }
+
+    int vertexCount = mesh->vertexCount;
+    float acmr = GetMeshCacheMissRatio(*mesh);
+
+    if (!WeldMeshVertices(mesh))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization failed, too many unique vertices for 16bit indices");
+        return;
+    }
+
+    int indexCount = mesh->triangleCount*3;
+
+    OptimizeIndicesVertexCache(mesh->indices, indexCount, mesh->vertexCount);
+    OptimizeIndicesOverdraw(mesh->indices, indexCount, mesh->vertices, mesh->vertexCount);
+    OptimizeMeshVertexFetch(mesh);
+
+    // Mesh was already uploaded to GPU, buffers layout changed so it requires a new upload
+    if (mesh->vaoId > 0)
+    {
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
+
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
+
+        UploadMesh(mesh, false);
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Optimized mesh: vertices %i -> %i | ACMR %.3f -> %.3f", vertexCount, mesh->vertexCount, acmr, GetMeshCacheMissRatio(*mesh));
+}
+
+// Get mesh average post-transform cache miss ratio (ACMR)
+// NOTE: Transformed vertices per triangle considering a FIFO cache of MESH_VERTEX_CACHE_SIZE entries,
+// values range from 0.5 (best case, big regular grids) to 3.0 (not indexed meshes)
+float GetMeshCacheMissRatio(Mesh mesh)
+{
+    if (mesh.triangleCount <= 0) return 0.0f;
+    if (mesh.indices == NULL) return 3.0f;
+
+    int cache[MESH_VERTEX_CACHE_SIZE] = { 0 };
+    int cacheCount = 0;
+    int cacheHead = 0;
+    int misses = 0;
+
+    for (int i = 0; i < mesh.triangleCount*3; i++)
+    {
+        int index = mesh.indices[i];
+        bool hit = false;
+
+        for (int c = 0; c < cacheCount; c++)
+        {
+            if (cache[c] == index) { hit = true; break; }
+        }
+
+        if (!hit)
+        {
+            misses++;
+
+            if (cacheCount < MESH_VERTEX_CACHE_SIZE) cache[cacheCount++] = index;
+            else
+            {
+                cache[cacheHead] = index;
+                cacheHead = (cacheHead + 1)%MESH_VERTEX_CACHE_SIZE;
+            }
+        }
+    }
+
+    return (float)misses/(float)mesh.triangleCount;
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -4045,36 +4328,45 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     if (mesh.vertices != NULL)
     {
         int triangleCount = mesh.triangleCount;
+        const Vector3 *vertices = (const Vector3 *)mesh.vertices;
+
+        // Vertices are transformed on the stack, no allocation per call: indexed meshes fitting the buffer
+        // transform all vertices once (shared by triangles), other meshes transform triangles by chunks
+        Vector3 transformed[RAY_COLLISION_MESH_VERTICES];
+        Vector3 points[RAY_COLLISION_MESH_CHUNK*3];
+        bool shared = (mesh.indices != NULL) && (mesh.vertexCount <= RAY_COLLISION_MESH_VERTICES);
+
+        if (shared) Vector3TransformArray(vertices, 0, mesh.vertexCount, transform, transformed, 0);
 
         // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        for (int start = 0; start < triangleCount; start += RAY_COLLISION_MESH_CHUNK)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            int count = triangleCount - start;
+            if (count > RAY_COLLISION_MESH_CHUNK) count = RAY_COLLISION_MESH_CHUNK;
+
+            const Vector3 *triangles = transformed;
 
-            if (mesh.indices)
+            if (shared)
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
+                for (int k = 0; k < count*3; k++) points[k] = transformed[mesh.indices[start*3 + k]];
+                triangles = points;
             }
-            else
+            else if (mesh.indices != NULL)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                for (int k = 0; k < count*3; k++) points[k] = vertices[mesh.indices[start*3 + k]];
+                Vector3TransformArray(points, 0, count*3, transform, transformed, 0);
             }
+            else Vector3TransformArray(vertices + start*3, 0, count*3, transform, transformed, 0);
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
-
-            if (triHitInfo.hit)
+            for (int i = 0; i < count; i++)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                RayCollision triHitInfo = GetRayCollisionTriangle(ray, triangles[i*3 + 0], triangles[i*3 + 1], triangles[i*3 + 2]);
+
+                if (triHitInfo.hit)
+                {
+                    // Save the closest hit triangle
+                    if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                }
             }
         }
     }
@@ -4158,6 +4450,587 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get mesh per-vertex attribute streams: data pointer and size in bytes per vertex
+// NOTE: Returns the number of streams available, position is always the first one
+static int GetMeshVertexStreams(Mesh *mesh, unsigned char ***streams, int *sizes)
+{
+    int count = 0;
+
+    #define MESH_STREAM(attrib, bytes) if (mesh->attrib != NULL) { streams[count] = (unsigned char **)&mesh->attrib; sizes[count] = (bytes); count++; }
+
+    MESH_STREAM(vertices, 3*sizeof(float))
+    MESH_STREAM(texcoords, 2*sizeof(float))
+    MESH_STREAM(texcoords2, 2*sizeof(float))
+    MESH_STREAM(normals, 3*sizeof(float))
+    MESH_STREAM(tangents, 4*sizeof(float))
+    MESH_STREAM(colors, 4*sizeof(unsigned char))
+    MESH_STREAM(animVertices, 3*sizeof(float))
+    MESH_STREAM(animNormals, 3*sizeof(float))
+    MESH_STREAM(boneIds, 4*sizeof(unsigned char))
+    MESH_STREAM(boneWeights, 4*sizeof(float))
+
+    #undef MESH_STREAM
+
+    return count;
+}
+
+// Reorder mesh vertex attributes, newVertex[i] is the old vertex index to be placed at i
+static void RemapMeshVertexStreams(Mesh *mesh, const int *newVertex, int newVertexCount)
+{
+    unsigned char **streams[MESH_MAX_VERTEX_STREAMS] = { 0 };
+    int sizes[MESH_MAX_VERTEX_STREAMS] = { 0 };
+    int streamCount = GetMeshVertexStreams(mesh, streams, sizes);
+
+    for (int s = 0; s < streamCount; s++)
+    {
+        unsigned char *data = *streams[s];
+        unsigned char *remapped = (unsigned char *)RL_MALLOC((size_t)newVertexCount*sizes[s]);
+
+        for (int i = 0; i < newVertexCount; i++) memcpy(remapped + (size_t)i*sizes[s], data + (size_t)newVertex[i]*sizes[s], sizes[s]);
+
+        RL_FREE(data);
+        *streams[s] = remapped;
+    }
+
+    mesh->vertexCount = newVertexCount;
+}
+
+// Weld mesh vertices with exactly the same attributes, generating an index buffer
+// NOTE: Returns false if resulting vertex count does not fit on 16bit indices, mesh is not modified
+static bool WeldMeshVertices(Mesh *mesh)
+{
+    unsigned char **streams[MESH_MAX_VERTEX_STREAMS] = { 0 };
+    int sizes[MESH_MAX_VERTEX_STREAMS] = { 0 };
+    int streamCount = GetMeshVertexStreams(mesh, streams, sizes);
+
+    int vertexCount = mesh->vertexCount;
+    int indexCount = (mesh->indices != NULL)? mesh->triangleCount*3 : vertexCount;
+
+    // Hash table with open addressing, stores unique vertex index (-1: empty slot)
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize <<= 1;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));         // Old vertex -> new vertex
+    int *unique = (int *)RL_MALLOC(vertexCount*sizeof(int));        // New vertex -> old vertex
+    int uniqueCount = 0;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        // FNV-1a hash over all vertex attributes
+        unsigned int hash = 2166136261u;
+        for (int s = 0; s < streamCount; s++)
+        {
+            const unsigned char *bytes = *streams[s] + (size_t)v*sizes[s];
+            for (int b = 0; b < sizes[s]; b++) hash = (hash ^ bytes[b])*16777619u;
+        }
+
+        unsigned int slot = hash & (tableSize - 1);
+
+        while (table[slot] != -1)
+        {
+            int other = unique[table[slot]];
+            bool equal = true;
+
+            for (int s = 0; (s < streamCount) && equal; s++)
+            {
+                equal = (memcmp(*streams[s] + (size_t)v*sizes[s], *streams[s] + (size_t)other*sizes[s], sizes[s]) == 0);
+            }
+
+            if (equal) break;
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (table[slot] == -1)
+        {
+            table[slot] = uniqueCount;
+            unique[uniqueCount] = v;
+            uniqueCount++;
+        }
+
+        remap[v] = table[slot];
+    }
+
+    bool result = (uniqueCount <= 65535);
+
+    if (result)
+    {
+        unsigned short *indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+        for (int i = 0; i < indexCount; i++) indices[i] = (unsigned short)remap[(mesh->indices != NULL)? mesh->indices[i] : i];
+
+        RL_FREE(mesh->indices);
+        mesh->indices = indices;
+        mesh->triangleCount = indexCount/3;
+
+        if (uniqueCount < vertexCount) RemapMeshVertexStreams(mesh, unique, uniqueCount);
+    }
+
+    RL_FREE(table);
+    RL_FREE(remap);
+    RL_FREE(unique);
+
+    return result;
+}
+
+// Get vertex score for post-transform cache optimization
+// NOTE: Scoring values as proposed by Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+static float GetVertexCacheScore(int cachePosition, int activeTriangles)
+{
+    if (activeTriangles == 0) return -1.0f;
+
+    float score = 0.0f;
+
+    if (cachePosition >= 0)
+    {
+        // Vertices used by the last triangle get a fixed score, so the next one is not biased by them
+        if (cachePosition < 3) score = 0.75f;
+        else score = powf(1.0f - (float)(cachePosition - 3)/(MESH_OPTIMIZE_CACHE_SIZE - 3), 1.5f);
+    }
+
+    // Boost vertices with few triangles left, to avoid leaving isolated triangles behind
+    score += 2.0f*powf((float)activeTriangles, -0.5f);
+
+    return score;
+}
+
+// Reorder triangles to improve post-transform vertex cache hits
+static void OptimizeIndicesVertexCache(unsigned short *indices, int indexCount, int vertexCount)
+{
+    if ((indexCount < 3) || (vertexCount < 3)) return;
+
+    int triangleCount = indexCount/3;
+
+    // Vertex-triangle adjacency: active triangles are kept at the start of every vertex list
+    int *activeCount = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *adjacencyOffset = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+
+    for (int i = 0; i < indexCount; i++) activeCount[indices[i]]++;
+
+    adjacencyOffset[0] = 0;
+    for (int v = 0; v < vertexCount; v++) adjacencyOffset[v + 1] = adjacencyOffset[v] + activeCount[v];
+
+    int *fill = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    for (int i = 0; i < indexCount; i++)
+    {
+        int v = indices[i];
+        adjacency[adjacencyOffset[v] + fill[v]++] = i/3;
+    }
+    RL_FREE(fill);
+
+    int *cachePosition = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScore = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    float *triangleScore = (float *)RL_CALLOC(triangleCount, sizeof(float));
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned short *output = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePosition[v] = -1;
+        vertexScore[v] = GetVertexCacheScore(-1, activeCount[v]);
+    }
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        triangleScore[t] = vertexScore[indices[t*3]] + vertexScore[indices[t*3 + 1]] + vertexScore[indices[t*3 + 2]];
+    }
+
+    // Simulated LRU cache, it can grow up to 3 entries over capacity while updating
+    int cache[MESH_OPTIMIZE_CACHE_SIZE + 3] = { 0 };
+    int newCache[MESH_OPTIMIZE_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+
+    int bestTriangle = 0;
+    int scanCursor = 0;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        if (bestTriangle < 0)
+        {
+            // No candidates connected to the cache, get next not emitted triangle in input order
+            while (emitted[scanCursor]) scanCursor++;
+            bestTriangle = scanCursor;
+        }
+
+        emitted[bestTriangle] = true;
+
+        int newCacheCount = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int v = indices[bestTriangle*3 + k];
+            output[t*3 + k] = (unsigned short)v;
+
+            // Remove emitted triangle from vertex active list
+            int *list = adjacency + adjacencyOffset[v];
+            for (int a = 0; a < activeCount[v]; a++)
+            {
+                if (list[a] == bestTriangle)
+                {
+                    list[a] = list[activeCount[v] - 1];
+                    list[activeCount[v] - 1] = bestTriangle;
+                    activeCount[v]--;
+                    break;
+                }
+            }
+
+            newCache[newCacheCount++] = v;
+        }
+
+        // Previous cache entries are pushed back after last triangle vertices
+        for (int c = 0; c < cacheCount; c++)
+        {
+            int v = cache[c];
+            if ((v != newCache[0]) && (v != newCache[1]) && (v != newCache[2])) newCache[newCacheCount++] = v;
+        }
+
+        // Update scores of cached vertices and their active triangles
+        for (int c = 0; c < newCacheCount; c++)
+        {
+            int v = newCache[c];
+            cachePosition[v] = (c < MESH_OPTIMIZE_CACHE_SIZE)? c : -1;
+
+            float score = GetVertexCacheScore(cachePosition[v], activeCount[v]);
+            float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+
+            for (int a = 0; a < activeCount[v]; a++) triangleScore[adjacency[adjacencyOffset[v] + a]] += delta;
+        }
+
+        cacheCount = (newCacheCount < MESH_OPTIMIZE_CACHE_SIZE)? newCacheCount : MESH_OPTIMIZE_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount*sizeof(int));
+
+        // Next triangle is the best scored one connected to the cache
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+
+        for (int c = 0; c < cacheCount; c++)
+        {
+            int v = cache[c];
+
+            for (int a = 0; a < activeCount[v]; a++)
+            {
+                int tri = adjacency[adjacencyOffset[v] + a];
+
+                if (triangleScore[tri] > bestScore)
+                {
+                    bestScore = triangleScore[tri];
+                    bestTriangle = tri;
+                }
+            }
+        }
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned short));
+
+    RL_FREE(activeCount);
+    RL_FREE(adjacencyOffset);
+    RL_FREE(adjacency);
+    RL_FREE(cachePosition);
+    RL_FREE(vertexScore);
+    RL_FREE(triangleScore);
+    RL_FREE(emitted);
+    RL_FREE(output);
+}
+
+// Reorder triangles clusters to reduce overdraw, keeping vertex cache efficiency
+// NOTE: Cache optimized sequence is split on hard cache boundaries (all triangle vertices missed),
+// clusters facing outwards from mesh center are drawn first so they occlude the rest
+static void OptimizeIndicesOverdraw(unsigned short *indices, int indexCount, const float *vertices, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+    if (triangleCount < 2) return;
+
+    Mesh reference = { 0 };
+    reference.triangleCount = triangleCount;
+    reference.indices = indices;
+    float acmrCache = GetMeshCacheMissRatio(reference);
+
+    // Split triangles sequence into clusters, simulating the FIFO cache used to measure ACMR
+    MeshCluster *clusters = (MeshCluster *)RL_MALLOC(triangleCount*sizeof(MeshCluster));
+    int clusterCount = 0;
+
+    int *cacheTime = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    for (int v = 0; v < vertexCount; v++) cacheTime[v] = -MESH_VERTEX_CACHE_SIZE - 1;
+    int time = 0;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int misses = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int v = indices[t*3 + k];
+            if ((time - cacheTime[v]) > MESH_VERTEX_CACHE_SIZE)
+            {
+                cacheTime[v] = time++;
+                misses++;
+            }
+        }
+
+        if ((t == 0) || (misses == 3))
+        {
+            clusters[clusterCount].start = t*3;
+            clusters[clusterCount].count = 0;
+            clusterCount++;
+        }
+
+        clusters[clusterCount - 1].count += 3;
+    }
+
+    RL_FREE(cacheTime);
+
+    if (clusterCount > 1)
+    {
+        // Mesh centroid
+        Vector3 meshCenter = { 0 };
+        for (int v = 0; v < vertexCount; v++) meshCenter = Vector3Add(meshCenter, (Vector3){ vertices[v*3], vertices[v*3 + 1], vertices[v*3 + 2] });
+        meshCenter = Vector3Scale(meshCenter, 1.0f/(float)vertexCount);
+
+        for (int c = 0; c < clusterCount; c++)
+        {
+            Vector3 center = { 0 };
+            Vector3 normal = { 0 };
+            float area = 0.0f;
+
+            for (int i = clusters[c].start; i < clusters[c].start + clusters[c].count; i += 3)
+            {
+                const float *p0 = vertices + indices[i]*3;
+                const float *p1 = vertices + indices[i + 1]*3;
+                const float *p2 = vertices + indices[i + 2]*3;
+
+                Vector3 v0 = { p0[0], p0[1], p0[2] };
+                Vector3 v1 = { p1[0], p1[1], p1[2] };
+                Vector3 v2 = { p2[0], p2[1], p2[2] };
+
+                // Cross product length is twice the triangle area, used as weight
+                Vector3 cross = Vector3CrossProduct(Vector3Subtract(v1, v0), Vector3Subtract(v2, v0));
+                float weight = Vector3Length(cross);
+
+                center = Vector3Add(center, Vector3Scale(Vector3Add(Vector3Add(v0, v1), v2), weight/3.0f));
+                normal = Vector3Add(normal, cross);
+                area += weight;
+            }
+
+            if (area > 0.0f) center = Vector3Scale(center, 1.0f/area);
+            normal = Vector3Normalize(normal);
+
+            clusters[c].sortKey = Vector3DotProduct(Vector3Subtract(center, meshCenter), normal);
+        }
+
+        // Sort by key (descending), original order kept for equal keys
+        // NOTE: Unwelded meshes get up to one cluster per triangle, so clusters count could be large
+        qsort(clusters, clusterCount, sizeof(MeshCluster), CompareMeshClusters);
+
+        unsigned short *sorted = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+        int offset = 0;
+
+        for (int c = 0; c < clusterCount; c++)
+        {
+            memcpy(sorted + offset, indices + clusters[c].start, clusters[c].count*sizeof(unsigned short));
+            offset += clusters[c].count;
+        }
+
+        // Keep new order only if cache efficiency is not significantly degraded
+        reference.indices = sorted;
+        if (GetMeshCacheMissRatio(reference) <= acmrCache*1.05f) memcpy(indices, sorted, indexCount*sizeof(unsigned short));
+
+        RL_FREE(sorted);
+    }
+
+    RL_FREE(clusters);
+}
+
+// Compare clusters by key (descending) and start (ascending), qsort() callback
+// NOTE: Start is unique and increases with cluster creation, sort result is the same as a stable sort
+static int CompareMeshClusters(const void *a, const void *b)
+{
+    const MeshCluster *clusterA = (const MeshCluster *)a;
+    const MeshCluster *clusterB = (const MeshCluster *)b;
+
+    if (clusterA->sortKey > clusterB->sortKey) return -1;
+    if (clusterA->sortKey < clusterB->sortKey) return 1;
+
+    return (clusterA->start > clusterB->start) - (clusterA->start < clusterB->start);
+}
+
+// Reorder mesh vertices by first use on index buffer, to improve vertex fetch locality
+static void OptimizeMeshVertexFetch(Mesh *mesh)
+{
+    int indexCount = mesh->triangleCount*3;
+
+    int *remap = (int *)RL_MALLOC(mesh->vertexCount*sizeof(int));       // Old vertex -> new vertex
+    int *order = (int *)RL_MALLOC(mesh->vertexCount*sizeof(int));       // New vertex -> old vertex
+    int usedCount = 0;
+
+    for (int v = 0; v < mesh->vertexCount; v++) remap[v] = -1;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        int v = mesh->indices[i];
+
+        if (remap[v] == -1)
+        {
+            remap[v] = usedCount;
+            order[usedCount] = v;
+            usedCount++;
+        }
+
+        mesh->indices[i] = (unsigned short)remap[v];
+    }
+
+    // NOTE: Unreferenced vertices are discarded
+    RemapMeshVertexStreams(mesh, order, usedCount);
+
+    RL_FREE(remap);
+    RL_FREE(order);
+}
+
+// Check if mesh bone matrices changed since last skinning, updating stored state
+// NOTE: Bone matrices are hashed (FNV-1a), meshes are identified by their animated vertex data
+static bool UpdateMeshSkinningState(Mesh mesh)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const unsigned char *bytes = (const unsigned char *)mesh.boneMatrices;
+
+    for (unsigned int i = 0; i < mesh.boneCount*sizeof(Matrix); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    int slot = -1;
+
+    for (int i = 0; i < MAX_MESH_SKINNING_STATES; i++)
+    {
+        if (skinningStates[i].animVertices == mesh.animVertices) { slot = i; break; }
+        if ((slot == -1) && (skinningStates[i].animVertices == NULL)) slot = i;
+    }
+
+    // No free states, replace one (that mesh will be skinned again on next update)
+    if (slot == -1) slot = (int)(((size_t)mesh.animVertices/sizeof(float))%MAX_MESH_SKINNING_STATES);
+
+    if ((skinningStates[slot].animVertices == mesh.animVertices) && (skinningStates[slot].posesHash == hash)) return false;
+
+    skinningStates[slot].animVertices = mesh.animVertices;
+    skinningStates[slot].posesHash = hash;
+
+    return true;
+}
+
+// Skin mesh vertex range, called from worker threads
+// NOTE: Weighted bone matrices are added into a single matrix per vertex, used to transform
+// position and normal (normals are only rotated/scaled, translation is not applied)
+static void SkinMeshVertices(void *userData, int start, int end)
+{
+    const MeshSkinningJob *job = (const MeshSkinningJob *)userData;
+    const Mesh *mesh = job->mesh;
+    const float *boneColumns = job->boneColumns;
+    bool skinNormals = (mesh->normals != NULL) && (mesh->animNormals != NULL);
+
+    for (int v = start; v < end; v++)
+    {
+        const float *weights = mesh->boneWeights + v*4;
+        const unsigned char *ids = mesh->boneIds + v*4;
+        const float *vertex = mesh->vertices + v*3;
+        float *animVertex = mesh->animVertices + v*3;
+
+#if defined(MESH_SKINNING_SIMD_SSE)
+        __m128 c0 = _mm_setzero_ps();
+        __m128 c1 = _mm_setzero_ps();
+        __m128 c2 = _mm_setzero_ps();
+        __m128 c3 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *col = boneColumns + ids[j]*16;
+            __m128 w = _mm_set1_ps(weights[j]);
+
+            c0 = _mm_add_ps(c0, _mm_mul_ps(w, _mm_loadu_ps(col)));
+            c1 = _mm_add_ps(c1, _mm_mul_ps(w, _mm_loadu_ps(col + 4)));
+            c2 = _mm_add_ps(c2, _mm_mul_ps(w, _mm_loadu_ps(col + 8)));
+            c3 = _mm_add_ps(c3, _mm_mul_ps(w, _mm_loadu_ps(col + 12)));
+        }
+
+        __m128 position = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(vertex[0])), _mm_mul_ps(c1, _mm_set1_ps(vertex[1]))),
+                                     _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(vertex[2])), c3));
+        _mm_storel_pi((__m64 *)animVertex, position);
+        _mm_store_ss(animVertex + 2, _mm_movehl_ps(position, position));
+
+        if (skinNormals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            __m128 n = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(normal[0])), _mm_mul_ps(c1, _mm_set1_ps(normal[1]))),
+                                  _mm_mul_ps(c2, _mm_set1_ps(normal[2])));
+            _mm_storel_pi((__m64 *)animNormal, n);
+            _mm_store_ss(animNormal + 2, _mm_movehl_ps(n, n));
+        }
+#elif defined(MESH_SKINNING_SIMD_NEON)
+        float32x4_t c0 = vdupq_n_f32(0.0f);
+        float32x4_t c1 = vdupq_n_f32(0.0f);
+        float32x4_t c2 = vdupq_n_f32(0.0f);
+        float32x4_t c3 = vdupq_n_f32(0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *col = boneColumns + ids[j]*16;
+
+            c0 = vmlaq_n_f32(c0, vld1q_f32(col), weights[j]);
+            c1 = vmlaq_n_f32(c1, vld1q_f32(col + 4), weights[j]);
+            c2 = vmlaq_n_f32(c2, vld1q_f32(col + 8), weights[j]);
+            c3 = vmlaq_n_f32(c3, vld1q_f32(col + 12), weights[j]);
+        }
+
+        float32x4_t position = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, vertex[0]), c1, vertex[1]), c2, vertex[2]);
+        vst1_f32(animVertex, vget_low_f32(position));
+        vst1q_lane_f32(animVertex + 2, position, 2);
+
+        if (skinNormals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            float32x4_t n = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(c0, normal[0]), c1, normal[1]), c2, normal[2]);
+            vst1_f32(animNormal, vget_low_f32(n));
+            vst1q_lane_f32(animNormal + 2, n, 2);
+        }
+#else
+        float c[16] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *col = boneColumns + ids[j]*16;
+            for (int k = 0; k < 16; k++) c[k] += weights[j]*col[k];
+        }
+
+        animVertex[0] = c[0]*vertex[0] + c[4]*vertex[1] + c[8]*vertex[2] + c[12];
+        animVertex[1] = c[1]*vertex[0] + c[5]*vertex[1] + c[9]*vertex[2] + c[13];
+        animVertex[2] = c[2]*vertex[0] + c[6]*vertex[1] + c[10]*vertex[2] + c[14];
+
+        if (skinNormals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            animNormal[0] = c[0]*normal[0] + c[4]*normal[1] + c[8]*normal[2];
+            animNormal[1] = c[1]*normal[0] + c[5]*normal[1] + c[9]*normal[2];
+            animNormal[2] = c[2]*normal[0] + c[6]*normal[1] + c[10]*normal[2];
+        }
+#endif
+    }
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
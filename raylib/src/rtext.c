@@ -62,6 +62,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
+#define RL_MEMORY_TAG MEMORY_TAG_TEXT   // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: LoadFile*()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
@@ -115,11 +116,54 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_GLYPH_INDEX_TABLES
+    #define MAX_GLYPH_INDEX_TABLES                 8        // Maximum number of fonts with a codepoint lookup table: GetGlyphIndex()
+#endif
+#ifndef DYNAMIC_FONT_ATLAS_WIDTH
+    #define DYNAMIC_FONT_ATLAS_WIDTH             512        // Dynamic font atlas width, height starts at width/4
+#endif
+#ifndef DYNAMIC_FONT_ATLAS_MAX_HEIGHT
+    #define DYNAMIC_FONT_ATLAS_MAX_HEIGHT       4096        // Dynamic font atlas maximum height, doubled when full
+#endif
+
+#define DYNAMIC_FONT_GLYPH_PADDING                 1        // Padding around dynamic font glyphs, avoids bleeding on filtering
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Codepoint to glyph index hash table of a font, built on first lookup
+typedef struct GlyphIndexTable {
+    const GlyphInfo *glyphs;    // Font glyphs the table was built for
+    int glyphCount;             // Font glyphs count the table was built for
+    int fallbackIndex;          // Index of fallback glyph '?'
+    int capacity;               // Number of slots, power of two
+    int *slots;                 // Glyph index + 1 per slot, 0 if empty
+} GlyphIndexTable;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Dynamic font glyph, rasterized at one pixel size
+typedef struct rDynamicGlyph {
+    int codepoint;              // Character value (Unicode)
+    int size;                   // Pixel size, 0 for an empty map slot
+    int offsetX;                // Character offset X when drawing
+    int offsetY;                // Character offset Y when drawing
+    int advanceX;               // Character advance position X
+    Rectangle rec;              // Rectangle in atlas, padding included (empty if nothing to draw)
+} rDynamicGlyph;
+
+// Dynamic font internal data
+struct rDynamicFont {
+    unsigned char *fileData;    // Font file data, read by stb_truetype on every rasterization
+    stbtt_fontinfo info;        // Font info for stb_truetype
+    Image atlas;                // Atlas copy in RAM, required to grow the texture
+    Texture2D texture;          // Atlas texture, replaced when the atlas grows
+    stbrp_context packer;       // Skyline packer, keeps packing into the same atlas
+    stbrp_node *nodes;          // Packer nodes, one per atlas column
+    rDynamicGlyph *glyphs;      // Glyphs map, open addressing keyed by codepoint and size
+    int glyphCount;             // Glyphs in map
+    int glyphCapacity;          // Glyphs map slots, power of two
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -145,8 +189,17 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static unsigned int HashCodepoint(int codepoint);           // Hash a codepoint for glyph lookup tables
+static GlyphIndexTable *LoadGlyphIndexTable(Font font);     // Get font glyph index table, built on first use
+static void UnloadGlyphIndexTable(const GlyphInfo *glyphs); // Unload glyph index table of a glyphs array
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static rDynamicGlyph GetDynamicGlyph(rDynamicFont *font, int codepoint, int size); // Get dynamic font glyph, rasterized on first use
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
+static GlyphIndexTable glyphIndexTables[MAX_GLYPH_INDEX_TABLES] = { 0 };    // Codepoint lookup tables, oldest replaced first
+static int glyphIndexTableNext = 0;             // Next codepoint lookup table to replace
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -309,6 +362,7 @@ extern void LoadFontDefault(void)
 extern void UnloadFontDefault(void)
 {
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
+    UnloadGlyphIndexTable(defaultFont.glyphs);
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
@@ -940,6 +994,7 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
     {
         for (int i = 0; i < glyphCount; i++) UnloadImage(glyphs[i].image);
 
+        UnloadGlyphIndexTable(glyphs);
         RL_FREE(glyphs);
     }
 }
@@ -1340,23 +1395,46 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+    if ((font.glyphs == NULL) || (font.glyphCount <= 0)) return index;
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+    // Fast path, default charsets are ordered starting at codepoint 32 (space)
+    if ((codepoint >= 32) && ((codepoint - 32) < font.glyphCount) && (font.glyphs[codepoint - 32].value == codepoint)) return (codepoint - 32);
 
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+    GlyphIndexTable *table = LoadGlyphIndexTable(font);
+
+    if (table != NULL)
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+        index = table->fallbackIndex;
 
-        if (font.glyphs[i].value == codepoint)
+        for (unsigned int slot = HashCodepoint(codepoint) & (table->capacity - 1); table->slots[slot] != 0; slot = (slot + 1) & (table->capacity - 1))
         {
-            index = i;
-            break;
+            if (font.glyphs[table->slots[slot] - 1].value == codepoint)
+            {
+                index = table->slots[slot] - 1;
+                break;
+            }
         }
     }
+    else
+    {
+        int fallbackIndex = 0;      // Get index of fallback glyph '?'
+
+        // Look for character index in the unordered charset
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].value == 63) fallbackIndex = i;
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+    }
 #else
     index = codepoint - 32;
 #endif
@@ -1386,6 +1464,198 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
+//----------------------------------------------------------------------------------
+// Dynamic font functions
+//----------------------------------------------------------------------------------
+// Load dynamic font from file, no glyph is rasterized until used
+DynamicFont LoadDynamicFont(const char *fileName)
+{
+    DynamicFont font = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font = LoadDynamicFontFromMemory(fileData, dataSize);
+        UnloadFileData(fileData);
+    }
+
+    if (font.data != NULL) TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load dynamic font", fileName);
+
+    return font;
+}
+
+// Load dynamic font from memory buffer (ttf/otf data), data is copied
+DynamicFont LoadDynamicFontFromMemory(const unsigned char *fileData, int dataSize)
+{
+    DynamicFont font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((fileData == NULL) || (dataSize <= 0)) return font;
+
+    rDynamicFont *data = (rDynamicFont *)RL_CALLOC(1, sizeof(rDynamicFont));
+    if (data == NULL) return font;
+
+    // NOTE: stb_truetype reads glyph outlines from the font data on every rasterization, keep our own copy
+    data->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    if (data->fileData != NULL) memcpy(data->fileData, fileData, dataSize);
+
+    if ((data->fileData == NULL) || !stbtt_InitFont(&data->info, data->fileData, stbtt_GetFontOffsetForIndex(data->fileData, 0)))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process dynamic font data");
+        RL_FREE(data->fileData);
+        RL_FREE(data);
+        return font;
+    }
+
+    // Atlas starts small and doubles its height when full, gray is white and alpha stores glyph coverage
+    data->atlas.width = DYNAMIC_FONT_ATLAS_WIDTH;
+    data->atlas.height = DYNAMIC_FONT_ATLAS_WIDTH/4;
+    data->atlas.mipmaps = 1;
+    data->atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    data->atlas.data = RL_MALLOC(data->atlas.width*data->atlas.height*2);
+    for (int i = 0; i < data->atlas.width*data->atlas.height; i++)
+    {
+        ((unsigned char *)data->atlas.data)[2*i] = 255;
+        ((unsigned char *)data->atlas.data)[2*i + 1] = 0;
+    }
+
+    if (isGpuReady) data->texture = LoadTextureFromImage(data->atlas);
+
+    data->nodes = (stbrp_node *)RL_MALLOC(data->atlas.width*sizeof(stbrp_node));
+    stbrp_init_target(&data->packer, data->atlas.width, data->atlas.height, data->nodes, data->atlas.width);
+
+    data->glyphCapacity = 256;
+    data->glyphs = (rDynamicGlyph *)RL_CALLOC(data->glyphCapacity, sizeof(rDynamicGlyph));
+
+    font.data = data;
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts require SUPPORT_FILEFORMAT_TTF");
+#endif
+
+    return font;
+}
+
+// Check if a dynamic font is valid
+bool IsDynamicFontValid(DynamicFont font)
+{
+    return (font.data != NULL);
+}
+
+// Unload dynamic font data, atlas included (RAM/VRAM)
+void UnloadDynamicFont(DynamicFont font)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.data == NULL) return;
+
+    if (isGpuReady) UnloadTexture(font.data->texture);
+    UnloadImage(font.data->atlas);
+    RL_FREE(font.data->nodes);
+    RL_FREE(font.data->glyphs);
+    RL_FREE(font.data->fileData);
+    RL_FREE(font.data);
+
+    TRACELOGD("FONT: Unloaded dynamic font data from RAM and VRAM");
+#endif
+}
+
+// Get dynamic font atlas texture
+// NOTE: Texture is replaced when the atlas grows, don't keep it across frames
+Texture2D GetDynamicFontTexture(DynamicFont font)
+{
+    Texture2D texture = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.data != NULL) texture = font.data->texture;
+#endif
+
+    return texture;
+}
+
+// Draw text using dynamic font, missing glyphs are rasterized at the requested size
+void DrawTextDynamic(DynamicFont font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font.data == NULL) || (text == NULL)) return;
+
+    int pixelSize = (fontSize < 1.0f)? 1 : (int)(fontSize + 0.5f);
+    float scaleFactor = fontSize/pixelSize;     // Glyphs are rasterized at integer sizes
+
+    float textOffsetX = 0.0f;
+    float textOffsetY = 0.0f;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        i += codepointByteCount;
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+            continue;
+        }
+
+        rDynamicGlyph glyph = GetDynamicGlyph(font.data, codepoint, pixelSize);
+
+        if ((codepoint != ' ') && (codepoint != '\t') && (glyph.rec.width > 0))
+        {
+            Rectangle dstRec = { position.x + textOffsetX + (glyph.offsetX - DYNAMIC_FONT_GLYPH_PADDING)*scaleFactor,
+                                 position.y + textOffsetY + (glyph.offsetY - DYNAMIC_FONT_GLYPH_PADDING)*scaleFactor,
+                                 glyph.rec.width*scaleFactor, glyph.rec.height*scaleFactor };
+
+            DrawTexturePro(font.data->texture, glyph.rec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+        }
+
+        textOffsetX += (glyph.advanceX*scaleFactor + spacing);
+    }
+#endif
+}
+
+// Measure string size for dynamic font
+Vector2 MeasureTextDynamic(DynamicFont font, const char *text, float fontSize, float spacing)
+{
+    Vector2 textSize = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font.data == NULL) || (text == NULL) || (text[0] == '\0')) return textSize;
+
+    int pixelSize = (fontSize < 1.0f)? 1 : (int)(fontSize + 0.5f);
+    float scaleFactor = fontSize/pixelSize;
+
+    float lineWidth = 0.0f;
+    int lineLength = 0;
+    textSize.y = fontSize;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        i += codepointByteCount;
+
+        if (codepoint == '\n')
+        {
+            textSize.y += (fontSize + textLineSpacing);
+            lineWidth = 0.0f;
+            lineLength = 0;
+            continue;
+        }
+
+        // NOTE: Spacing is added between glyphs, not after the last one
+        if (lineLength > 0) lineWidth += spacing;
+        lineWidth += GetDynamicGlyph(font.data, codepoint, pixelSize).advanceX*scaleFactor;
+        lineLength++;
+
+        if (lineWidth > textSize.x) textSize.x = lineWidth;
+    }
+#endif
+
+    return textSize;
+}
+
 //----------------------------------------------------------------------------------
 // Text strings management functions
 //----------------------------------------------------------------------------------
@@ -1405,7 +1675,9 @@ unsigned int TextLength(const char *text)
 }
 
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// NOTE: String is copied to frame memory (MemAllocFrame()), it doesn't expire until EndDrawing()
+// WARNING: Frame memory and the static buffers are not thread-safe, call it from main thread only
+// WARNING: Once frame memory is exhausted, string returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1417,7 +1689,6 @@ const char *TextFormat(const char *text, ...)
     static int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
@@ -1430,11 +1701,25 @@ const char *TextFormat(const char *text, ...)
         // Inserting "..." at the end of the string to mark as truncated
         char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
         sprintf(truncBuffer, "...");
+        requiredByteCount = MAX_TEXT_BUFFER_LENGTH - 1;
+    }
+    else if (requiredByteCount < 0)
+    {
+        currentBuffer[0] = '\0';    // Encoding error, empty string returned
+        requiredByteCount = 0;
     }
 
     index += 1;     // Move to next buffer for next function call
     if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
 
+    char *frameBuffer = (char *)MemAllocFrame(requiredByteCount + 1);
+
+    if (frameBuffer != NULL)
+    {
+        memcpy(frameBuffer, currentBuffer, requiredByteCount + 1);
+        return frameBuffer;
+    }
+
     return currentBuffer;
 }
 
@@ -2570,4 +2855,211 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+// Hash a codepoint to look it up in a glyph index table
+static unsigned int HashCodepoint(int codepoint)
+{
+    unsigned int hash = (unsigned int)codepoint*2654435761u;
+
+    return (hash ^ (hash >> 16));
+}
+
+// Get the glyph index table of a font, built on first use
+// NOTE: Tables are keyed by glyphs array, fonts modifying glyph codepoints after drawing are not supported
+static GlyphIndexTable *LoadGlyphIndexTable(Font font)
+{
+    for (int i = 0; i < MAX_GLYPH_INDEX_TABLES; i++)
+    {
+        if ((glyphIndexTables[i].glyphs == font.glyphs) && (glyphIndexTables[i].glyphCount == font.glyphCount)) return &glyphIndexTables[i];
+    }
+
+    // Replace the oldest table
+    GlyphIndexTable *table = &glyphIndexTables[glyphIndexTableNext];
+    glyphIndexTableNext = (glyphIndexTableNext + 1)%MAX_GLYPH_INDEX_TABLES;
+
+    RL_FREE(table->slots);
+    memset(table, 0, sizeof(GlyphIndexTable));
+
+    int capacity = 16;
+    while (capacity < 2*font.glyphCount) capacity *= 2;     // Load factor below 0.5
+
+    table->slots = (int *)RL_CALLOC(capacity, sizeof(int));
+    if (table->slots == NULL) return NULL;
+
+    table->glyphs = font.glyphs;
+    table->glyphCount = font.glyphCount;
+    table->capacity = capacity;
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == 63) table->fallbackIndex = i;
+
+        unsigned int slot = HashCodepoint(font.glyphs[i].value) & (capacity - 1);
+
+        // NOTE: On duplicated codepoints the first glyph is kept, same as a linear search
+        while ((table->slots[slot] != 0) && (font.glyphs[table->slots[slot] - 1].value != font.glyphs[i].value)) slot = (slot + 1) & (capacity - 1);
+        if (table->slots[slot] == 0) table->slots[slot] = i + 1;
+    }
+
+    return table;
+}
+
+// Unload the glyph index table of a glyphs array, if any
+static void UnloadGlyphIndexTable(const GlyphInfo *glyphs)
+{
+    for (int i = 0; i < MAX_GLYPH_INDEX_TABLES; i++)
+    {
+        if (glyphIndexTables[i].glyphs == glyphs)
+        {
+            RL_FREE(glyphIndexTables[i].slots);
+            memset(&glyphIndexTables[i], 0, sizeof(GlyphIndexTable));
+        }
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Hash a glyph key (codepoint and pixel size) to look it up in a dynamic font
+static unsigned int HashDynamicGlyph(int codepoint, int size)
+{
+    return HashCodepoint(codepoint ^ (size << 21));
+}
+
+// Insert a glyph in the dynamic font glyph map, growing it if required
+static void AddDynamicGlyph(rDynamicFont *font, rDynamicGlyph glyph)
+{
+    if (4*(font->glyphCount + 1) > 3*font->glyphCapacity)
+    {
+        rDynamicGlyph *glyphs = font->glyphs;
+        int capacity = font->glyphCapacity;
+
+        font->glyphCapacity *= 2;
+        font->glyphs = (rDynamicGlyph *)RL_CALLOC(font->glyphCapacity, sizeof(rDynamicGlyph));
+        font->glyphCount = 0;
+
+        for (int i = 0; i < capacity; i++) if (glyphs[i].size != 0) AddDynamicGlyph(font, glyphs[i]);
+
+        RL_FREE(glyphs);
+    }
+
+    unsigned int slot = HashDynamicGlyph(glyph.codepoint, glyph.size) & (font->glyphCapacity - 1);
+    while (font->glyphs[slot].size != 0) slot = (slot + 1) & (font->glyphCapacity - 1);
+
+    font->glyphs[slot] = glyph;
+    font->glyphCount++;
+}
+
+// Double the dynamic font atlas height, returns false if already at max size
+static bool GrowDynamicFontAtlas(rDynamicFont *font)
+{
+    int height = font->atlas.height*2;
+    if (height > DYNAMIC_FONT_ATLAS_MAX_HEIGHT) return false;
+
+    unsigned char *pixels = (unsigned char *)RL_REALLOC(font->atlas.data, font->atlas.width*height*2);
+    if (pixels == NULL) return false;
+
+    for (int i = font->atlas.width*font->atlas.height; i < font->atlas.width*height; i++)
+    {
+        pixels[2*i] = 255;
+        pixels[2*i + 1] = 0;
+    }
+
+    font->atlas.data = pixels;
+    font->atlas.height = height;
+
+    // NOTE: Skyline packer only checks the height limit on new rectangles, packed ones stay valid
+    font->packer.height = height;
+
+    // Text already batched uses the previous texture, draw it before unloading
+    if (isGpuReady)
+    {
+        rlDrawRenderBatchActive();
+        UnloadTexture(font->texture);
+        font->texture = LoadTextureFromImage(font->atlas);
+    }
+
+    TRACELOG(LOG_INFO, "FONT: Dynamic font atlas resized to %ix%i", font->atlas.width, height);
+
+    return true;
+}
+
+// Get a dynamic font glyph, rasterized and packed into the atlas on first use
+// NOTE: Returned by value, the glyph map may be reallocated by later lookups
+static rDynamicGlyph GetDynamicGlyph(rDynamicFont *font, int codepoint, int size)
+{
+    unsigned int slot = HashDynamicGlyph(codepoint, size) & (font->glyphCapacity - 1);
+
+    for (; font->glyphs[slot].size != 0; slot = (slot + 1) & (font->glyphCapacity - 1))
+    {
+        if ((font->glyphs[slot].codepoint == codepoint) && (font->glyphs[slot].size == size)) return font->glyphs[slot];
+    }
+
+    rDynamicGlyph glyph = { 0 };
+
+    // Codepoints missing in the font are drawn as '?', same as regular fonts
+    if ((codepoint != 63) && (stbtt_FindGlyphIndex(&font->info, codepoint) == 0))
+    {
+        glyph = GetDynamicGlyph(font, 63, size);
+        glyph.codepoint = codepoint;
+        AddDynamicGlyph(font, glyph);
+        return glyph;
+    }
+
+    glyph.codepoint = codepoint;
+    glyph.size = size;
+
+    float scaleFactor = stbtt_ScaleForPixelHeight(&font->info, (float)size);
+    int ascent = 0, x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    stbtt_GetFontVMetrics(&font->info, &ascent, NULL, NULL);
+    stbtt_GetCodepointHMetrics(&font->info, codepoint, &glyph.advanceX, NULL);
+    stbtt_GetCodepointBitmapBox(&font->info, codepoint, scaleFactor, scaleFactor, &x0, &y0, &x1, &y1);
+
+    glyph.advanceX = (int)((float)glyph.advanceX*scaleFactor);
+    glyph.offsetX = x0;
+    glyph.offsetY = y0 + (int)((float)ascent*scaleFactor);
+
+    int width = x1 - x0;
+    int height = y1 - y0;
+
+    if ((width > 0) && (height > 0) && (codepoint != ' ') && (codepoint != '\t'))
+    {
+        stbrp_rect rect = { 0, width + 2*DYNAMIC_FONT_GLYPH_PADDING, height + 2*DYNAMIC_FONT_GLYPH_PADDING, 0, 0, 0 };
+
+        stbrp_pack_rects(&font->packer, &rect, 1);
+        while (!rect.was_packed && GrowDynamicFontAtlas(font)) stbrp_pack_rects(&font->packer, &rect, 1);
+
+        if (rect.was_packed)
+        {
+            unsigned char *bitmap = (unsigned char *)RL_CALLOC(rect.w*rect.h, 1);
+            stbtt_MakeCodepointBitmap(&font->info, bitmap + DYNAMIC_FONT_GLYPH_PADDING*rect.w + DYNAMIC_FONT_GLYPH_PADDING,
+                                      width, height, rect.w, scaleFactor, scaleFactor, codepoint);
+
+            // Copy coverage into the atlas alpha channel and upload only the glyph rectangle
+            unsigned char *pixels = (unsigned char *)RL_MALLOC(rect.w*rect.h*2);
+            for (int y = 0; y < rect.h; y++)
+            {
+                unsigned char *row = (unsigned char *)font->atlas.data + ((rect.y + y)*font->atlas.width + rect.x)*2;
+
+                for (int x = 0; x < rect.w; x++)
+                {
+                    row[2*x + 1] = bitmap[y*rect.w + x];
+                    pixels[(y*rect.w + x)*2] = 255;
+                    pixels[(y*rect.w + x)*2 + 1] = bitmap[y*rect.w + x];
+                }
+            }
+
+            glyph.rec = (Rectangle){ (float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h };
+            if (isGpuReady) UpdateTextureRec(font->texture, glyph.rec, pixels);
+
+            RL_FREE(pixels);
+            RL_FREE(bitmap);
+        }
+        else TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas full, glyph %i at size %i not drawn", codepoint, size);
+    }
+
+    AddDynamicGlyph(font, glyph);
+
+    return glyph;
+}
+#endif      // SUPPORT_FILEFORMAT_TTF
+
 #endif      // SUPPORT_MODULE_RTEXT
@@ -34,6 +34,9 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_COMPRESSION
+*           Support image compression to GPU block formats (DXT1/DXT3/DXT5, ETC1/ETC2/EAC), ImageCompress()
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -70,8 +73,10 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
+#define RL_MEMORY_TAG MEMORY_TAG_TEXTURES   // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"              // Required for: TRACELOG()
 #include "rlgl.h"               // OpenGL abstraction layer to multiple versions
+#include "raymath.h"            // Required for: RAYMATH_SIMD_* [Used in ImageFormat() pixel converters]
 
 #include <stdlib.h>             // Required for: malloc(), calloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
@@ -236,15 +241,117 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef PIXEL_CONVERSION_BATCH_SIZE
+    #define PIXEL_CONVERSION_BATCH_SIZE  256    // Pixels converted per batch through a normalized Vector4 buffer (generic path)
+#endif
+
+#ifndef IMAGE_PROCESSING_BATCH_PIXELS
+    #define IMAGE_PROCESSING_BATCH_PIXELS  16384    // Pixels processed per worker job batch by image processing functions
+#endif
+
+#ifndef IMAGE_COMPRESSION_QUALITY
+    #define IMAGE_COMPRESSION_QUALITY  1    // Block compression quality used by ImageFormat() to compressed formats, 0 (fast) to 2 (best)
+#endif
+
+#ifndef IMAGE_COMPRESSION_BATCH_BLOCKS
+    #define IMAGE_COMPRESSION_BATCH_BLOCKS  256     // Blocks compressed per worker job batch, rounded to full rows of blocks
+#endif
+
+#define BLUR_COLUMNS_TILE   16      // Columns blurred together by vertical blur pass, rows are walked in memory order
+
+// NOTE: sRGB tables are loaded once by first caller, ImageMipmapsEx() could be called from several threads
+#if defined(_MSC_VER)
+    #include <intrin.h>                 // Required for: _InterlockedCompareExchange()
+    #define SRGB_TABLES_CAS(ptr, expected, desired) (_InterlockedCompareExchange((volatile long *)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+#else
+    #define SRGB_TABLES_CAS(ptr, expected, desired) __sync_bool_compare_and_swap(ptr, expected, desired)
+#endif
+
+#if defined(RAYMATH_SIMD_AVX2) || defined(RAYMATH_SIMD_SSE2)
+    #define PIXEL_CONVERSION_SIMD_SSE           // 8bit pixel converters process 4 pixels per 128bit vector
+    #define IMAGE_PROCESSING_SIMD_SSE           // Image processing kernels process RGBA channels as 128bit vectors
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Direct pixel converter, converts count pixels from src to dst
+typedef void (*PixelConverter)(const unsigned char *src, unsigned char *dst, int count);
+
+typedef struct PixelConversion {
+    int srcFormat;                  // Source pixel format (PixelFormat type)
+    int dstFormat;                  // Destination pixel format (PixelFormat type)
+    PixelConverter convert;         // Converter function
+} PixelConversion;
+
+// Image processing job, image rows (or columns) are processed in batches by worker threads
+typedef struct ImageProcessingJob {
+    Color *pixels;                  // Image pixels (R8G8B8A8)
+    Vector4 *buffer;                // Float pixels buffer (blur, convolution)
+    Vector4 *buffer2;               // Float pixels buffer (blur intermediate pass)
+    int width;                      // Image width
+    int height;                     // Image height
+    int blurSize;                   // Blur size (box blur radius)
+    const float *kernel;            // Convolution kernel (square)
+    int kernelWidth;                // Convolution kernel width
+    Color tint;                     // Tint color
+    unsigned char table[256];       // Color channels lookup table (contrast, brightness)
+} ImageProcessingJob;
+
+// Image drawing job, destination rows are drawn in batches by worker threads
+typedef struct ImageDrawJob {
+    const unsigned char *srcBase;   // Source first pixel to draw
+    unsigned char *dstBase;         // Destination first pixel to draw
+    int srcStride;                  // Source row size in bytes
+    int dstStride;                  // Destination row size in bytes
+    int srcBytesPerPixel;           // Source pixel size in bytes
+    int dstBytesPerPixel;           // Destination pixel size in bytes
+    int srcFormat;                  // Source pixel format
+    int dstFormat;                  // Destination pixel format
+    int width;                      // Pixels to draw per row
+    bool blendRequired;             // Source pixels are alpha blended with tint
+    Color tint;                     // Source tint color
+} ImageDrawJob;
+
+// ETC block encoding, two sub-blocks of 8 pixels sharing the block mode
+typedef struct EtcBlock {
+    bool differential;              // Differential mode (5bit base and 3bit delta) or individual mode (4bit bases)
+    bool flip;                      // Sub-blocks are 4x2 (top/bottom) instead of 2x4 (left/right)
+    int base[2][3];                 // Quantized base colors of sub-blocks
+    int table[2];                   // Modifier tables of sub-blocks
+    unsigned char indices[2][8];    // Modifier indices of sub-blocks pixels
+    int error[2];                   // Squared error of sub-blocks
+} EtcBlock;
+
+// Image mipmap job, rows of a mipmap level are downsampled from the previous level by worker threads
+typedef struct ImageMipmapJob {
+    const unsigned char *src;       // Previous level pixels
+    unsigned char *dst;             // Level pixels
+    int srcWidth;                   // Previous level width
+    int srcHeight;                  // Previous level height
+    int dstWidth;                   // Level width
+    int dstHeight;                  // Level height
+    int channels;                   // Channels per pixel (8bit): gray, gray alpha, RGB, RGBA
+    bool srgb;                      // Color channels are averaged in linear space (alpha always is)
+} ImageMipmapJob;
+
+// Image compression job, rows of 4x4 pixel blocks are compressed in batches by worker threads
+typedef struct ImageCompressionJob {
+    const Color *pixels;            // Image level pixels (R8G8B8A8)
+    unsigned char *blocks;          // Compressed level data
+    int width;                      // Image level width
+    int height;                     // Image level height
+    int format;                     // Compressed pixel format
+    int blockSize;                  // Compressed block size in bytes
+    int quality;                    // Compression quality: 0 (fast) to 2 (best)
+} ImageCompressionJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static unsigned short srgbToLinear[256] = { 0 };    // sRGB 8bit to linear 16bit values table (sRGB mipmaps)
+static unsigned char linearToSrgb[65536] = { 0 };   // Linear 16bit to sRGB 8bit values table (sRGB mipmaps)
+static volatile long srgbTablesState = 0;           // sRGB tables state: 0-not loaded, 1-loading, 2-loaded
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -256,7 +363,30 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
-static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void ConvertPixels(const void *src, int srcFormat, void *dst, int dstFormat, int count);    // Convert pixels between uncompressed formats
+
+static int GetImageJobBatchSize(int lineLength);                            // Get worker job batch size for image lines of provided length
+static void PremultiplyImageRows(void *userData, int start, int end);       // Premultiply alpha of image rows (worker job callback)
+static void ExpandImageRows(void *userData, int start, int end);            // Expand image rows to float buffer (worker job callback)
+static void NormalizeImageRows(void *userData, int start, int end);         // Normalize image rows to float buffer (worker job callback)
+static void BlurImageRows(void *userData, int start, int end);              // Horizontal box blur of image rows (worker job callback)
+static void BlurImageColumns(void *userData, int start, int end);           // Vertical box blur of image columns (worker job callback)
+static void UnpremultiplyImageRows(void *userData, int start, int end);     // Reverse premultiply of image rows (worker job callback)
+static void ConvolveImageRows(void *userData, int start, int end);          // Convolve image rows with kernel (worker job callback)
+static void TintImageRows(void *userData, int start, int end);              // Tint image rows (worker job callback)
+static void MapImageRows(void *userData, int start, int end);               // Map image rows color channels through lookup table (worker job callback)
+static void DrawImageRows(void *userData, int start, int end);              // Draw source image rows into destination (worker job callback)
+static void LoadSrgbTables(void);                                           // Load sRGB <--> linear conversion tables (sRGB mipmaps)
+static void DownsampleImageRows(void *userData, int start, int end);        // Downsample image rows to next mipmap level, 2x2 box filter (worker job callback)
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+static void CompressImageBlockRows(void *userData, int start, int end);     // Compress rows of 4x4 pixel blocks (worker job callback)
+static void CompressBlockDXT(const Color *block, unsigned char *output, bool transparent, int quality);    // Compress DXT (BC1) color block
+static void CompressBlockAlphaDXT3(const Color *block, unsigned char *output);                       // Compress DXT3 (BC2) explicit alpha block
+static void CompressBlockAlphaDXT5(const Color *block, unsigned char *output, int quality);          // Compress DXT5 (BC3) interpolated alpha block
+static void CompressBlockETC(const Color *block, unsigned char *output, int quality);                // Compress ETC1/ETC2 color block
+static void CompressBlockAlphaEAC(const Color *block, unsigned char *output, int quality);           // Compress ETC2 EAC alpha block
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -637,7 +767,7 @@ bool ExportImage(Image image, const char *fileName)
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
         // NOTE: Getting Color array as RGBA unsigned char values
         imgData = (unsigned char *)LoadImageColors(image);
@@ -685,6 +815,13 @@ bool ExportImage(Image image, const char *fileName)
         }
     }
 #endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds"))
+    {
+        // NOTE: Compressed (DXT) or R8G8B8A8 data is saved as is, including mipmaps
+        result = rl_save_dds(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+#endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx"))
     {
@@ -1260,202 +1397,144 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // NOTE: Pixels are converted straight into the new buffer, no intermediate copy
+            void *data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+            ConvertPixels(image->data, image->format, data, newFormat, image->width*image->height);
 
             RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
+            image->data = data;
             image->format = newFormat;
 
-            switch (image->format)
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (image->data != NULL) ImageMipmaps(image);
+            #endif
+            }
+        }
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+        else if (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) ImageCompress(image, newFormat, IMAGE_COMPRESSION_QUALITY);
+#endif
+        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
+    }
+}
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+// Compress image data to GPU block compressed format
+// NOTE: Supported formats: DXT1 (RGB, RGBA), DXT3, DXT5, ETC1, ETC2 (RGB, EAC RGBA), mipmaps are compressed too,
+// every level is compressed in parallel by rows of 4x4 pixel blocks
+void ImageCompress(Image *image, int newFormat, int quality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    int blockSize = 0;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    switch (newFormat)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: blockSize = 8; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: blockSize = 16; break;
+        default: break;
+    }
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+    if (blockSize == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported (%i)", newFormat);
+        return;
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
+        return;
+    }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+    if (((image->width%4) != 0) || ((image->height%4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed formats require image size multiple of 4 (%ix%i)", image->width, image->height);
+        return;
+    }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+    if (quality < 0) quality = 0;
+    else if (quality > 2) quality = 2;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+    // NOTE: Mipmaps data size is computed as for any other format (GetPixelDataSize()), it matches the blocks
+    // required only if both sizes are multiple of 4 or both are smaller than 4, longer chains (non square images) are cut
+    int mipmaps = 0;
+    int dataSize = 0;
+    int pixelsSize = image->width*image->height;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        bool blocksMatch = (((width%4) == 0) && ((height%4) == 0)) || ((width < 4) && (height < 4));
+        if (!blocksMatch) break;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+        dataSize += GetPixelDataSize(width, height, newFormat);
+        mipmaps++;
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+    if (mipmaps < image->mipmaps) TRACELOG(LOG_WARNING, "IMAGE: Compressed mipmaps chain cut to %i levels (%ix%i)", mipmaps, image->width, image->height);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+    unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+    Color *pixels = (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)RL_MALLOC(pixelsSize*sizeof(Color)) : NULL;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+    int srcOffset = 0;
+    int dstOffset = 0;
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    for (int i = 0, width = image->width, height = image->height; i < mipmaps; i++)
+    {
+        const unsigned char *src = (const unsigned char *)image->data + srcOffset;
+
+        ImageCompressionJob job = { 0 };
+        job.pixels = (const Color *)src;
+        job.blocks = data + dstOffset;
+        job.width = width;
+        job.height = height;
+        job.format = newFormat;
+        job.blockSize = blockSize;
+        job.quality = quality;
+
+        if (pixels != NULL)
+        {
+            ConvertPixels(src, image->format, pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, width*height);
+            job.pixels = pixels;
+        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+        int blocksPerRow = (width + 3)/4;
+        int batchSize = IMAGE_COMPRESSION_BATCH_BLOCKS/blocksPerRow;
+        RunWorkerJob(CompressImageBlockRows, &job, (height + 3)/4, (batchSize > 0)? batchSize : 1);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+        srcOffset += GetPixelDataSize(width, height, image->format);
+        dstOffset += GetPixelDataSize(width, height, newFormat);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+    RL_FREE(pixels);
+    RL_FREE(image->data);
 
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
-            {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
-            }
-        }
-        else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
-    }
+    image->data = data;
+    image->format = newFormat;
+    image->mipmaps = mipmaps;
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: Image compression not supported (SUPPORT_IMAGE_COMPRESSION)");
+#endif
 }
 
 // Create an image from text (default font)
@@ -2060,36 +2139,24 @@ void ImageAlphaPremultiply(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.width = image->width;
+    job.height = image->height;
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
+    RunWorkerJob(PremultiplyImageRows, &job, image->height, GetImageJobBatchSize(image->width));
 
     RL_FREE(image->data);
 
     int format = image->format;
-    image->data = pixels;
+    image->data = job.pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
 }
 
 // Apply box blur to image
+// NOTE: Rows and columns are blurred in parallel on worker threads
 void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
@@ -2097,137 +2164,36 @@ void ImageBlurGaussian(Image *image, int blurSize)
 
     ImageAlphaPremultiply(image);
 
-    Color *pixels = LoadImageColors(*image);
+    // Loop switches between buffer and buffer2
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.buffer = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    job.buffer2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    job.width = image->width;
+    job.height = image->height;
+    job.blurSize = blurSize;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    int rowsBatchSize = GetImageJobBatchSize(image->width);
+    int columnsBatchSize = GetImageJobBatchSize(image->height);
+    columnsBatchSize = ((columnsBatchSize + BLUR_COLUMNS_TILE - 1)/BLUR_COLUMNS_TILE)*BLUR_COLUMNS_TILE;
 
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    RunWorkerJob(ExpandImageRows, &job, image->height, rowsBatchSize);
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        RunWorkerJob(BlurImageRows, &job, image->height, rowsBatchSize);            // Horizontal motion blur
+        RunWorkerJob(BlurImageColumns, &job, image->width, columnsBatchSize);       // Vertical motion blur
     }
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
+    RunWorkerJob(UnpremultiplyImageRows, &job, image->height, rowsBatchSize);      // Reverse premultiply
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    RL_FREE(job.buffer);
+    RL_FREE(job.buffer2);
 
-    image->data = pixels;
+    image->data = job.pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
@@ -2247,130 +2213,45 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         return;
     }
 
-    Color *pixels = LoadImageColors(*image);
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.buffer = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    job.width = image->width;
+    job.height = image->height;
+    job.kernel = kernel;
+    job.kernelWidth = kernelWidth;
 
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
+    int batchSize = GetImageJobBatchSize(image->width*kernelSize);
 
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
+    // Pixels are normalized once, convolution reads them from buffer and writes result to pixels
+    RunWorkerJob(NormalizeImageRows, &job, image->height, GetImageJobBatchSize(image->width));
+    RunWorkerJob(ConvolveImageRows, &job, image->height, batchSize);
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    int format = image->format;
+    RL_FREE(image->data);
+    RL_FREE(job.buffer);
 
-    int startRange = 0, endRange = 0;
+    image->data = job.pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    ImageFormat(image, format);
+}
 
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
+// Generate all mipmap levels for a provided image
+// NOTE 1: Supports POT and NPOT images
+// NOTE 2: image.data is scaled to include mipmap levels
+// NOTE 3: Mipmaps format is the same as base image
+void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, false);
+}
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
-
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
-
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
-}
-
-// Generate all mipmap levels for a provided image
-// NOTE 1: Supports POT and NPOT images
-// NOTE 2: image.data is scaled to include mipmap levels
-// NOTE 3: Mipmaps format is the same as base image
-void ImageMipmaps(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+// Generate all mipmap levels for a provided image, optionally averaging colors in linear space (sRGB images)
+// NOTE: 8bit gray, gray alpha, RGB and RGBA levels are downsampled from the previous level with a 2x2 box filter,
+// straight into the image buffer; other formats and odd sized levels (NPOT) are resized with ImageResize()
+void ImageMipmapsEx(Image *image, bool srgb)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     int mipCount = 1;                   // Required mipmap levels count (including base level)
     int mipWidth = image->width;        // Base image width
@@ -2397,19 +2278,41 @@ void ImageMipmaps(Image *image)
     {
         void *temp = RL_REALLOC(image->data, mipSize);
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        if (temp == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        image->data = temp;      // Assign new pointer (new size) to store mipmaps data
+
+        int channels = 0;
+        switch (image->format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+            default: break;
+        }
+
+        if (srgb && (channels > 0)) LoadSrgbTables();
+        else if (srgb) TRACELOG(LOG_WARNING, "IMAGE: sRGB mipmaps only supported for 8bit formats, using linear averaging");
 
         // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *prevmip = NULL;
         unsigned char *nextmip = image->data;
 
         mipWidth = image->width;
         mipHeight = image->height;
         mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
         {
+            int prevWidth = mipWidth;
+            int prevHeight = mipHeight;
+
+            prevmip = nextmip;
             nextmip += mipSize;
 
             mipWidth /= 2;
@@ -2425,12 +2328,34 @@ void ImageMipmaps(Image *image)
 
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+            // Box filter requires every level pixel to cover 2x2 previous level pixels (or 2x1/1x2 once a side reached 1)
+            bool boxFilter = (channels > 0) && (((prevWidth%2) == 0) || (prevWidth == 1)) && (((prevHeight%2) == 0) || (prevHeight == 1));
 
-            memcpy(nextmip, imCopy.data, mipSize);
-        }
+            if (boxFilter)
+            {
+                ImageMipmapJob job = { 0 };
+                job.src = prevmip;
+                job.dst = nextmip;
+                job.srcWidth = prevWidth;
+                job.srcHeight = prevHeight;
+                job.dstWidth = mipWidth;
+                job.dstHeight = mipHeight;
+                job.channels = channels;
+                job.srgb = srgb;
+
+                RunWorkerJob(DownsampleImageRows, &job, mipHeight, GetImageJobBatchSize(prevWidth*2));
+            }
+            else
+            {
+                Image prevLevel = { RL_MALLOC(GetPixelDataSize(prevWidth, prevHeight, image->format)), prevWidth, prevHeight, 1, image->format };
+                memcpy(prevLevel.data, prevmip, GetPixelDataSize(prevWidth, prevHeight, image->format));
+
+                ImageResize(&prevLevel, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
 
-        UnloadImage(imCopy);
+                memcpy(nextmip, prevLevel.data, mipSize);
+                UnloadImage(prevLevel);
+            }
+        }
 
         image->mipmaps = mipCount;
     }
@@ -2747,25 +2672,18 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.width = image->width;
+    job.height = image->height;
+    job.tint = color;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
+    RunWorkerJob(TintImageRows, &job, image->height, GetImageJobBatchSize(image->width));
 
     int format = image->format;
     RL_FREE(image->data);
 
-    image->data = pixels;
+    image->data = job.pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
@@ -2814,43 +2732,31 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = LoadImageColors(*image);
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.width = image->width;
+    job.height = image->height;
 
-    for (int i = 0; i < image->width*image->height; i++)
+    // NOTE: Result only depends on channel value, it is computed once per value
+    for (int i = 0; i < 256; i++)
     {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
+        float p = (float)i/255.0f;
+        p -= 0.5f;
+        p *= contrast;
+        p += 0.5f;
+        p *= 255;
+        if (p < 0) p = 0;
+        if (p > 255) p = 255;
+
+        job.table[i] = (unsigned char)p;
     }
 
+    RunWorkerJob(MapImageRows, &job, image->height, GetImageJobBatchSize(image->width));
+
     int format = image->format;
     RL_FREE(image->data);
 
-    image->data = pixels;
+    image->data = job.pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
@@ -2866,32 +2772,28 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = LoadImageColors(*image);
+    ImageProcessingJob job = { 0 };
+    job.pixels = LoadImageColors(*image);
+    job.width = image->width;
+    job.height = image->height;
 
-    for (int i = 0; i < image->width*image->height; i++)
+    // NOTE: Result only depends on channel value, it is computed once per value
+    for (int i = 0; i < 256; i++)
     {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
+        int c = i + brightness;
 
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+        if (c < 0) c = 1;
+        if (c > 255) c = 255;
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
+        job.table[i] = (unsigned char)c;
     }
 
+    RunWorkerJob(MapImageRows, &job, image->height, GetImageJobBatchSize(image->width));
+
     int format = image->format;
     RL_FREE(image->data);
 
-    image->data = pixels;
+    image->data = job.pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     ImageFormat(image, format);
@@ -3980,7 +3882,6 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
 
         // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
 
-        Color colSrc, colDst, blend;
         bool blendRequired = true;
 
         // Fast path: Avoid blend if source has no alpha to blend
@@ -4000,37 +3901,21 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
         int bytesPerPixelSrc = strideSrc/(srcPtr->width);
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
-
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
-
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
-
-                    SetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
-
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
-        }
+        ImageDrawJob job = { 0 };
+        job.srcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+        job.dstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+        job.srcStride = strideSrc;
+        job.dstStride = strideDst;
+        job.srcBytesPerPixel = bytesPerPixelSrc;
+        job.dstBytesPerPixel = bytesPerPixelDst;
+        job.srcFormat = srcPtr->format;
+        job.dstFormat = dst->format;
+        job.width = (int)srcRec.width;
+        job.blendRequired = blendRequired;
+        job.tint = tint;
+
+        // Rows are drawn in parallel on worker threads, small images are drawn on calling thread
+        if (job.width > 0) RunWorkerJob(DrawImageRows, &job, (int)srcRec.height, GetImageJobBatchSize(job.width));
 
         if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
 
@@ -5409,140 +5294,1813 @@ static unsigned short FloatToHalf(float x)
     return result;
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Load pixels from image data as Vector4 array (float normalized), supports 8 to 32 bit per channel
+// NOTE: Pixels [offset, offset + count) are loaded into pixels[0, count)
+static void LoadPixelsNormalized(const void *data, int format, int offset, int count, Vector4 *pixels)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    const unsigned char *data8 = (const unsigned char *)data;
+    const unsigned short *data16 = (const unsigned short *)data;
+    const float *data32 = (const float *)data;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    for (int i = 0, p = offset; i < count; i++, p++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        switch (format)
         {
-            switch (image.format)
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                pixels[i].x = (float)data8[p]/255.0f;
+                pixels[i].y = (float)data8[p]/255.0f;
+                pixels[i].z = (float)data8[p]/255.0f;
+                pixels[i].w = 1.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                int k = p*2;
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                pixels[i].x = (float)data8[k]/255.0f;
+                pixels[i].y = (float)data8[k]/255.0f;
+                pixels[i].z = (float)data8[k]/255.0f;
+                pixels[i].w = (float)data8[k + 1]/255.0f;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = data16[p];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = data16[p];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                pixels[i].w = 1.0f;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = data16[p];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+                pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                int k = p*4;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                pixels[i].x = (float)data8[k]/255.0f;
+                pixels[i].y = (float)data8[k + 1]/255.0f;
+                pixels[i].z = (float)data8[k + 2]/255.0f;
+                pixels[i].w = (float)data8[k + 3]/255.0f;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                int k = p*3;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                pixels[i].x = (float)data8[k]/255.0f;
+                pixels[i].y = (float)data8[k + 1]/255.0f;
+                pixels[i].z = (float)data8[k + 2]/255.0f;
+                pixels[i].w = 1.0f;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].x = data32[p];
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                int k = p*3;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+                pixels[i].x = data32[k];
+                pixels[i].y = data32[k + 1];
+                pixels[i].z = data32[k + 2];
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                int k = p*4;
+
+                pixels[i].x = data32[k];
+                pixels[i].y = data32[k + 1];
+                pixels[i].z = data32[k + 2];
+                pixels[i].w = data32[k + 3];
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].x = HalfToFloat(data16[p]);
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                int k = p*3;
+
+                pixels[i].x = HalfToFloat(data16[k]);
+                pixels[i].y = HalfToFloat(data16[k + 1]);
+                pixels[i].z = HalfToFloat(data16[k + 2]);
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                int k = p*4;
+
+                pixels[i].x = HalfToFloat(data16[k]);
+                pixels[i].y = HalfToFloat(data16[k + 1]);
+                pixels[i].z = HalfToFloat(data16[k + 2]);
+                pixels[i].w = HalfToFloat(data16[k + 3]);
+
+            } break;
+            default: break;
         }
     }
+}
 
-    return pixels;
+// Store Vector4 array (float normalized) pixels into image data
+// NOTE: pixels[0, count) are stored into pixels [offset, offset + count)
+static void StorePixelsNormalized(void *data, int format, int offset, int count, const Vector4 *pixels)
+{
+    unsigned char *data8 = (unsigned char *)data;
+    unsigned short *data16 = (unsigned short *)data;
+    float *data32 = (float *)data;
+
+    for (int i = 0, p = offset; i < count; i++, p++)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                data8[p] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                int k = p*2;
+
+                data8[k] = (unsigned char)((pixels[i].x*0.299f + (float)pixels[i].y*0.587f + (float)pixels[i].z*0.114f)*255.0f);
+                data8[k + 1] = (unsigned char)(pixels[i].w*255.0f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*31.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*63.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                data16[p] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                int k = p*3;
+
+                data8[k] = (unsigned char)(pixels[i].x*255.0f);
+                data8[k + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data8[k + 2] = (unsigned char)(pixels[i].z*255.0f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*31.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*31.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*31.0f));
+                unsigned char a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                data16[p] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*15.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*15.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*15.0f));
+                unsigned char a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                data16[p] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                int k = p*4;
+
+                data8[k] = (unsigned char)(pixels[i].x*255.0f);
+                data8[k + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data8[k + 2] = (unsigned char)(pixels[i].z*255.0f);
+                data8[k + 3] = (unsigned char)(pixels[i].w*255.0f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                data32[p] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                int k = p*3;
+
+                data32[k] = pixels[i].x;
+                data32[k + 1] = pixels[i].y;
+                data32[k + 2] = pixels[i].z;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                int k = p*4;
+
+                data32[k] = pixels[i].x;
+                data32[k + 1] = pixels[i].y;
+                data32[k + 2] = pixels[i].z;
+                data32[k + 3] = pixels[i].w;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                data16[p] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                int k = p*3;
+
+                data16[k] = FloatToHalf(pixels[i].x);
+                data16[k + 1] = FloatToHalf(pixels[i].y);
+                data16[k + 2] = FloatToHalf(pixels[i].z);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                int k = p*4;
+
+                data16[k] = FloatToHalf(pixels[i].x);
+                data16[k + 1] = FloatToHalf(pixels[i].y);
+                data16[k + 2] = FloatToHalf(pixels[i].z);
+                data16[k + 3] = FloatToHalf(pixels[i].w);
+
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Convert pixels between any uncompressed formats, in batches through a small normalized buffer
+static void ConvertPixelsNormalized(const void *src, int srcFormat, void *dst, int dstFormat, int count)
+{
+    Vector4 pixels[PIXEL_CONVERSION_BATCH_SIZE];
+
+    for (int offset = 0; offset < count; offset += PIXEL_CONVERSION_BATCH_SIZE)
+    {
+        int batch = ((count - offset) < PIXEL_CONVERSION_BATCH_SIZE)? (count - offset) : PIXEL_CONVERSION_BATCH_SIZE;
+
+        LoadPixelsNormalized(src, srcFormat, offset, batch, pixels);
+        StorePixelsNormalized(dst, dstFormat, offset, batch, pixels);
+    }
+}
+
+// Direct pixel converters for 8bit formats, no normalized intermediate
+// NOTE: Results are bit-exact with ConvertPixelsNormalized():
+//  - 8bit channels round trip exactly through (float)v/255.0f*255.0f, they are just copied
+//  - Quantization tables are computed with the same float expressions than the normalized path
+//  - Grayscale uses the same float operations in the same order (no FMA), also in SIMD kernels
+static void LoadQuantizeTable(unsigned char *table, float levels)
+{
+    for (int v = 0; v < 256; v++) table[v] = (unsigned char)(round(((float)v/255.0f)*levels));
+}
+
+static void LoadExpandTable(unsigned char *table, int levels)
+{
+    for (int v = 0; v <= levels; v++) table[v] = (unsigned char)(((float)v*(1.0f/levels))*255.0f);
+}
+
+static void LoadNormalizeTable(float *table)
+{
+    for (int v = 0; v < 256; v++) table[v] = (float)v/255.0f;
+}
+
+static inline unsigned char GetPixelGray(const float *normalized, const unsigned char *pixel)
+{
+    return (unsigned char)((normalized[pixel[0]]*0.299f + normalized[pixel[1]]*0.587f + normalized[pixel[2]]*0.114f)*255.0f);
+}
+
+#if defined(PIXEL_CONVERSION_SIMD_SSE)
+// Load 4 pixels into 32bit lanes as RGBA8
+static inline __m128i LoadPixelsSSE(const unsigned char *src, int channels)
+{
+    if (channels == 4) return _mm_loadu_si128((const __m128i *)src);
+
+    return _mm_setr_epi32((int)(src[0] | (src[1] << 8) | (src[2] << 16) | 0xff000000u), (int)(src[3] | (src[4] << 8) | (src[5] << 16) | 0xff000000u),
+                          (int)(src[6] | (src[7] << 8) | (src[8] << 16) | 0xff000000u), (int)(src[9] | (src[10] << 8) | (src[11] << 16) | 0xff000000u));
+}
+
+// Get channel from 4 RGBA8 pixels into 32bit lanes
+static inline __m128i GetPixelsChannelSSE(__m128i pixels, int channel)
+{
+    return _mm_and_si128(_mm_srli_epi32(pixels, channel*8), _mm_set1_epi32(0xff));
+}
+
+// Grayscale of 4 RGBA8 pixels into 32bit lanes
+static inline __m128i GetPixelsGraySSE(__m128i pixels)
+{
+    const __m128 scale = _mm_set1_ps(255.0f);
+    __m128 r = _mm_div_ps(_mm_cvtepi32_ps(GetPixelsChannelSSE(pixels, 0)), scale);
+    __m128 g = _mm_div_ps(_mm_cvtepi32_ps(GetPixelsChannelSSE(pixels, 1)), scale);
+    __m128 b = _mm_div_ps(_mm_cvtepi32_ps(GetPixelsChannelSSE(pixels, 2)), scale);
+
+    __m128 gray = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+
+    return _mm_cvttps_epi32(_mm_mul_ps(gray, scale));
+}
+
+// Quantize 8bit channel in 32bit lanes to [0..levels], round(v/255*levels) computed as (v*levels + 127)/255
+static inline __m128i QuantizePixelsChannelSSE(__m128i channel, int levels)
+{
+    __m128i x = _mm_add_epi32(_mm_mullo_epi16(channel, _mm_set1_epi32(levels)), _mm_set1_epi32(128));
+
+    return _mm_srli_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 8)), 8);
+}
+
+// Pack 16bit values in 32bit lanes and store them
+static inline void StorePixels16SSE(unsigned char *dst, __m128i values)
+{
+    values = _mm_srai_epi32(_mm_slli_epi32(values, 16), 16);     // Sign extend so packing does not saturate
+    _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(values, values));
+}
+
+// Pack 8bit values in 32bit lanes and store them
+static inline void StorePixels8SSE(unsigned char *dst, __m128i values)
+{
+    int packed = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(values, values), values));
+    memcpy(dst, &packed, 4);
+}
+#endif
+
+static void ConvertPixelsGray(const unsigned char *src, int channels, unsigned char *dst, int alpha, int count)
+{
+    float normalized[256] = { 0 };
+    LoadNormalizeTable(normalized);
+
+    int dstChannels = alpha? 2 : 1;
+    int i = 0;
+
+#if defined(PIXEL_CONVERSION_SIMD_SSE)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = LoadPixelsSSE(src + i*channels, channels);
+        __m128i gray = GetPixelsGraySSE(pixels);
+
+        if (alpha) StorePixels16SSE(dst + i*2, _mm_or_si128(gray, _mm_slli_epi32(GetPixelsChannelSSE(pixels, 3), 8)));
+        else StorePixels8SSE(dst + i, gray);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        dst[i*dstChannels] = GetPixelGray(normalized, src + i*channels);
+        if (alpha) dst[i*dstChannels + 1] = (channels == 4)? src[i*channels + 3] : 255;
+    }
+}
+
+static void ConvertPixelsPacked16(const unsigned char *src, int channels, unsigned char *dst, int format, int count)
+{
+    unsigned char quantize5[256] = { 0 };
+    unsigned char quantize6[256] = { 0 };
+    unsigned char quantize4[256] = { 0 };
+    LoadQuantizeTable(quantize5, 31.0f);
+    LoadQuantizeTable(quantize6, 63.0f);
+    LoadQuantizeTable(quantize4, 15.0f);
+
+    unsigned short *dst16 = (unsigned short *)dst;
+    int i = 0;
+
+#if defined(PIXEL_CONVERSION_SIMD_SSE)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = LoadPixelsSSE(src + i*channels, channels);
+        __m128i r = GetPixelsChannelSSE(pixels, 0);
+        __m128i g = GetPixelsChannelSSE(pixels, 1);
+        __m128i b = GetPixelsChannelSSE(pixels, 2);
+        __m128i a = GetPixelsChannelSSE(pixels, 3);
+        __m128i result = _mm_setzero_si128();
+
+        if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+        {
+            result = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(QuantizePixelsChannelSSE(r, 31), 11),
+                _mm_slli_epi32(QuantizePixelsChannelSSE(g, 63), 5)), QuantizePixelsChannelSSE(b, 31));
+        }
+        else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+        {
+            __m128i alpha = _mm_and_si128(_mm_cmpgt_epi32(a, _mm_set1_epi32(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), _mm_set1_epi32(1));
+            result = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(QuantizePixelsChannelSSE(r, 31), 11), _mm_slli_epi32(QuantizePixelsChannelSSE(g, 31), 6)),
+                _mm_or_si128(_mm_slli_epi32(QuantizePixelsChannelSSE(b, 31), 1), alpha));
+        }
+        else
+        {
+            result = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(QuantizePixelsChannelSSE(r, 15), 12), _mm_slli_epi32(QuantizePixelsChannelSSE(g, 15), 8)),
+                _mm_or_si128(_mm_slli_epi32(QuantizePixelsChannelSSE(b, 15), 4), QuantizePixelsChannelSSE(a, 15)));
+        }
+
+        StorePixels16SSE(dst + i*2, result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const unsigned char *pixel = src + i*channels;
+        unsigned char a = (channels == 4)? pixel[3] : 255;
+
+        if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) dst16[i] = (unsigned short)quantize5[pixel[0]] << 11 | (unsigned short)quantize6[pixel[1]] << 5 | (unsigned short)quantize5[pixel[2]];
+        else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+        {
+            dst16[i] = (unsigned short)quantize5[pixel[0]] << 11 | (unsigned short)quantize5[pixel[1]] << 6 | (unsigned short)quantize5[pixel[2]] << 1 |
+                       (((float)a/255.0f > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0);
+        }
+        else dst16[i] = (unsigned short)quantize4[pixel[0]] << 12 | (unsigned short)quantize4[pixel[1]] << 8 | (unsigned short)quantize4[pixel[2]] << 4 | (unsigned short)quantize4[a];
+    }
+}
+
+static void ConvertPixelsUnpacked16(const unsigned char *src, int format, unsigned char *dst, int channels, int count)
+{
+    unsigned char expand5[32] = { 0 };
+    unsigned char expand6[64] = { 0 };
+    unsigned char expand4[16] = { 0 };
+    LoadExpandTable(expand5, 31);
+    LoadExpandTable(expand6, 63);
+    LoadExpandTable(expand4, 15);
+
+    const unsigned short *src16 = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned short pixel = src16[i];
+        unsigned char *result = dst + i*channels;
+        unsigned char a = 255;
+
+        if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+        {
+            result[0] = expand5[pixel >> 11];
+            result[1] = expand6[(pixel >> 5) & 0x3f];
+            result[2] = expand5[pixel & 0x1f];
+        }
+        else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+        {
+            result[0] = expand5[pixel >> 11];
+            result[1] = expand5[(pixel >> 6) & 0x1f];
+            result[2] = expand5[(pixel >> 1) & 0x1f];
+            a = (pixel & 1)? 255 : 0;
+        }
+        else
+        {
+            result[0] = expand4[pixel >> 12];
+            result[1] = expand4[(pixel >> 8) & 0xf];
+            result[2] = expand4[(pixel >> 4) & 0xf];
+            a = expand4[pixel & 0xf];
+        }
+
+        if (channels == 4) result[3] = a;
+    }
+}
+
+static void ConvertR8G8B8A8ToR8G8B8(const unsigned char *src, unsigned char *dst, int count)
+{
+    for (int i = 0; i < count; i++, src += 4, dst += 3) { dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; }
+}
+
+static void ConvertR8G8B8ToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count)
+{
+    for (int i = 0; i < count; i++, src += 3, dst += 4) { dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; }
+}
+
+static void ConvertGrayscaleToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count)
+{
+    for (int i = 0; i < count; i++, dst += 4) { dst[0] = src[i]; dst[1] = src[i]; dst[2] = src[i]; dst[3] = 255; }
+}
+
+static void ConvertGrayscaleToR8G8B8(const unsigned char *src, unsigned char *dst, int count)
+{
+    for (int i = 0; i < count; i++, dst += 3) { dst[0] = src[i]; dst[1] = src[i]; dst[2] = src[i]; }
+}
+
+static void ConvertGrayAlphaToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count)
+{
+    for (int i = 0; i < count; i++, src += 2, dst += 4) { dst[0] = src[0]; dst[1] = src[0]; dst[2] = src[0]; dst[3] = src[1]; }
+}
+
+static void ConvertR8G8B8A8ToGrayscale(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsGray(src, 4, dst, 0, count); }
+static void ConvertR8G8B8ToGrayscale(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsGray(src, 3, dst, 0, count); }
+static void ConvertR8G8B8A8ToGrayAlpha(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsGray(src, 4, dst, 1, count); }
+static void ConvertR8G8B8ToGrayAlpha(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsGray(src, 3, dst, 1, count); }
+static void ConvertR8G8B8A8ToR5G6B5(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 4, dst, PIXELFORMAT_UNCOMPRESSED_R5G6B5, count); }
+static void ConvertR8G8B8ToR5G6B5(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 3, dst, PIXELFORMAT_UNCOMPRESSED_R5G6B5, count); }
+static void ConvertR8G8B8A8ToR5G5B5A1(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 4, dst, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, count); }
+static void ConvertR8G8B8ToR5G5B5A1(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 3, dst, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, count); }
+static void ConvertR8G8B8A8ToR4G4B4A4(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 4, dst, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, count); }
+static void ConvertR8G8B8ToR4G4B4A4(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsPacked16(src, 3, dst, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, count); }
+static void ConvertR5G6B5ToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R5G6B5, dst, 4, count); }
+static void ConvertR5G6B5ToR8G8B8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R5G6B5, dst, 3, count); }
+static void ConvertR5G5B5A1ToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, dst, 4, count); }
+static void ConvertR5G5B5A1ToR8G8B8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, dst, 3, count); }
+static void ConvertR4G4B4A4ToR8G8B8A8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, dst, 4, count); }
+static void ConvertR4G4B4A4ToR8G8B8(const unsigned char *src, unsigned char *dst, int count) { ConvertPixelsUnpacked16(src, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, dst, 3, count); }
+
+// Direct converters table, pairs not listed go through ConvertPixelsNormalized()
+static const PixelConversion pixelConversions[] = {
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ConvertR8G8B8A8ToR8G8B8 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertR8G8B8ToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertGrayscaleToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ConvertGrayscaleToR8G8B8 },
+    { PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertGrayAlphaToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, ConvertR8G8B8A8ToGrayscale },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, ConvertR8G8B8ToGrayscale },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, ConvertR8G8B8A8ToGrayAlpha },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, ConvertR8G8B8ToGrayAlpha },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R5G6B5, ConvertR8G8B8A8ToR5G6B5 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R5G6B5, ConvertR8G8B8ToR5G6B5 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, ConvertR8G8B8A8ToR5G5B5A1 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, ConvertR8G8B8ToR5G5B5A1 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, ConvertR8G8B8A8ToR4G4B4A4 },
+    { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, ConvertR8G8B8ToR4G4B4A4 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertR5G6B5ToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ConvertR5G6B5ToR8G8B8 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertR5G5B5A1ToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ConvertR5G5B5A1ToR8G8B8 },
+    { PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, ConvertR4G4B4A4ToR8G8B8A8 },
+    { PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, PIXELFORMAT_UNCOMPRESSED_R8G8B8, ConvertR4G4B4A4ToR8G8B8 },
+};
+
+// Convert pixels between uncompressed formats, direct converter if available
+static void ConvertPixels(const void *src, int srcFormat, void *dst, int dstFormat, int count)
+{
+    for (int i = 0; i < (int)(sizeof(pixelConversions)/sizeof(pixelConversions[0])); i++)
+    {
+        if ((pixelConversions[i].srcFormat == srcFormat) && (pixelConversions[i].dstFormat == dstFormat))
+        {
+            pixelConversions[i].convert((const unsigned char *)src, (unsigned char *)dst, count);
+            return;
+        }
+    }
+
+    ConvertPixelsNormalized(src, srcFormat, dst, dstFormat, count);
+}
+
+// Get worker job batch size (in lines) for image lines (rows or columns) of provided length
+static int GetImageJobBatchSize(int lineLength)
+{
+    int batchSize = IMAGE_PROCESSING_BATCH_PIXELS/((lineLength > 0)? lineLength : 1);
+
+    return (batchSize > 0)? batchSize : 1;
+}
+
+// Float pixel operations for image processing kernels, RGBA channels processed as one 128bit vector if available
+// NOTE: Operations are the same per channel than scalar ones and in the same order, results are bit-exact
+#if defined(IMAGE_PROCESSING_SIMD_SSE)
+typedef __m128 PixelFloat;
+
+static inline PixelFloat PixelFloatZero(void) { return _mm_setzero_ps(); }
+static inline PixelFloat PixelFloatLoad(const Vector4 *v) { return _mm_loadu_ps((const float *)v); }
+static inline void PixelFloatStore(Vector4 *v, PixelFloat p) { _mm_storeu_ps((float *)v, p); }
+static inline PixelFloat PixelFloatAdd(PixelFloat a, PixelFloat b) { return _mm_add_ps(a, b); }
+static inline PixelFloat PixelFloatSubtract(PixelFloat a, PixelFloat b) { return _mm_sub_ps(a, b); }
+static inline PixelFloat PixelFloatScale(PixelFloat p, float scale) { return _mm_mul_ps(p, _mm_set1_ps(scale)); }
+static inline PixelFloat PixelFloatDivide(PixelFloat p, float div) { return _mm_div_ps(p, _mm_set1_ps(div)); }
+static inline PixelFloat PixelFloatTruncate(PixelFloat p) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(p)); }
+#else
+typedef Vector4 PixelFloat;
+
+static inline PixelFloat PixelFloatZero(void) { return (PixelFloat){ 0.0f, 0.0f, 0.0f, 0.0f }; }
+static inline PixelFloat PixelFloatLoad(const Vector4 *v) { return *v; }
+static inline void PixelFloatStore(Vector4 *v, PixelFloat p) { *v = p; }
+static inline PixelFloat PixelFloatAdd(PixelFloat a, PixelFloat b) { return (PixelFloat){ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
+static inline PixelFloat PixelFloatSubtract(PixelFloat a, PixelFloat b) { return (PixelFloat){ a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; }
+static inline PixelFloat PixelFloatScale(PixelFloat p, float scale) { return (PixelFloat){ p.x*scale, p.y*scale, p.z*scale, p.w*scale }; }
+static inline PixelFloat PixelFloatDivide(PixelFloat p, float div) { return (PixelFloat){ p.x/div, p.y/div, p.z/div, p.w/div }; }
+static inline PixelFloat PixelFloatTruncate(PixelFloat p) { return (PixelFloat){ (float)(int)p.x, (float)(int)p.y, (float)(int)p.z, (float)(int)p.w }; }
+#endif
+
+// Premultiply alpha of image rows (worker job callback)
+// NOTE: Channels are multiplied by (float)alpha/255.0f, it keeps them unchanged for alpha 255 and sets them to 0 for alpha 0
+static void PremultiplyImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    Color *pixels = job->pixels + start*job->width;
+    int count = (end - start)*job->width;
+    int i = 0;
+
+#if defined(IMAGE_PROCESSING_SIMD_SSE)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 colorMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 alphaOne = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i color = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i color16[2] = { _mm_unpacklo_epi8(color, zero), _mm_unpackhi_epi8(color, zero) };
+        __m128i result[4] = { 0 };
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128 pixel = _mm_cvtepi32_ps((k%2 == 0)? _mm_unpacklo_epi16(color16[k/2], zero) : _mm_unpackhi_epi16(color16[k/2], zero));
+            __m128 alpha = _mm_div_ps(_mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(255.0f));
+
+            result[k] = _mm_cvttps_epi32(_mm_mul_ps(pixel, _mm_or_ps(_mm_and_ps(alpha, colorMask), alphaOne)));
+        }
+
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_packus_epi16(_mm_packs_epi32(result[0], result[1]), _mm_packs_epi32(result[2], result[3])));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (pixels[i].a == 0)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        }
+        else if (pixels[i].a < 255)
+        {
+            float alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        }
+    }
+}
+
+// Expand image rows pixels to float buffer, channels in range [0..255] (worker job callback)
+static void ExpandImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+
+    for (int i = start*job->width; i < end*job->width; i++)
+    {
+        job->buffer[i].x = job->pixels[i].r;
+        job->buffer[i].y = job->pixels[i].g;
+        job->buffer[i].z = job->pixels[i].b;
+        job->buffer[i].w = job->pixels[i].a;
+    }
+}
+
+// Normalize image rows pixels to float buffer, channels in range [0..1] (worker job callback)
+static void NormalizeImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+
+    for (int i = start*job->width; i < end*job->width; i++)
+    {
+        job->buffer[i].x = (float)job->pixels[i].r/255.0f;
+        job->buffer[i].y = (float)job->pixels[i].g/255.0f;
+        job->buffer[i].z = (float)job->pixels[i].b/255.0f;
+        job->buffer[i].w = (float)job->pixels[i].a/255.0f;
+    }
+}
+
+// Horizontal box blur of image rows, from buffer to buffer2 (worker job callback)
+static void BlurImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    int width = job->width;
+    int blurSize = job->blurSize;
+
+    for (int row = start; row < end; row++)
+    {
+        const Vector4 *src = job->buffer + row*width;
+        Vector4 *dst = job->buffer2 + row*width;
+
+        PixelFloat avg = PixelFloatZero();
+        int convolutionSize = blurSize;
+
+        // NOTE: Window start is limited to row, image could be smaller than blur size
+        for (int i = 0; (i < blurSize) && (i < width); i++) avg = PixelFloatAdd(avg, PixelFloatLoad(&src[i]));
+
+        for (int x = 0; x < width; x++)
+        {
+            if (x-blurSize-1 >= 0)
+            {
+                avg = PixelFloatSubtract(avg, PixelFloatLoad(&src[x-blurSize-1]));
+                convolutionSize--;
+            }
+
+            if (x+blurSize < width)
+            {
+                avg = PixelFloatAdd(avg, PixelFloatLoad(&src[x+blurSize]));
+                convolutionSize++;
+            }
+
+            PixelFloatStore(&dst[x], PixelFloatDivide(avg, (float)convolutionSize));
+        }
+    }
+}
+
+// Vertical box blur of image columns, from buffer2 to buffer, values truncated (worker job callback)
+// NOTE: Columns are processed in tiles of BLUR_COLUMNS_TILE, walking rows in memory order
+static void BlurImageColumns(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    int width = job->width;
+    int height = job->height;
+    int blurSize = job->blurSize;
+
+    for (int col = start; col < end; col += BLUR_COLUMNS_TILE)
+    {
+        PixelFloat avg[BLUR_COLUMNS_TILE];
+        int tileSize = ((end - col) < BLUR_COLUMNS_TILE)? (end - col) : BLUR_COLUMNS_TILE;
+        int convolutionSize = blurSize;
+
+        for (int c = 0; c < tileSize; c++) avg[c] = PixelFloatZero();
+
+        for (int i = 0; (i < blurSize) && (i < height); i++)
+        {
+            const Vector4 *src = job->buffer2 + i*width + col;
+            for (int c = 0; c < tileSize; c++) avg[c] = PixelFloatAdd(avg[c], PixelFloatLoad(&src[c]));
+        }
+
+        for (int y = 0; y < height; y++)
+        {
+            if (y-blurSize-1 >= 0)
+            {
+                const Vector4 *src = job->buffer2 + (y-blurSize-1)*width + col;
+                for (int c = 0; c < tileSize; c++) avg[c] = PixelFloatSubtract(avg[c], PixelFloatLoad(&src[c]));
+                convolutionSize--;
+            }
+
+            if (y+blurSize < height)
+            {
+                const Vector4 *src = job->buffer2 + (y+blurSize)*width + col;
+                for (int c = 0; c < tileSize; c++) avg[c] = PixelFloatAdd(avg[c], PixelFloatLoad(&src[c]));
+                convolutionSize++;
+            }
+
+            Vector4 *dst = job->buffer + y*width + col;
+            for (int c = 0; c < tileSize; c++) PixelFloatStore(&dst[c], PixelFloatTruncate(PixelFloatDivide(avg[c], (float)convolutionSize)));
+        }
+    }
+}
+
+// Reverse premultiply of image rows, from buffer to pixels (worker job callback)
+static void UnpremultiplyImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    const Vector4 *buffer = job->buffer;
+    Color *pixels = job->pixels;
+
+    for (int i = start*job->width; i < end*job->width; i++)
+    {
+        if (buffer[i].w == 0.0f)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+            pixels[i].a = 0;
+        }
+        else if (buffer[i].w <= 255.0f)
+        {
+            float alpha = (float)buffer[i].w/255.0f;
+            pixels[i].r = (unsigned char)((float)buffer[i].x/alpha);
+            pixels[i].g = (unsigned char)((float)buffer[i].y/alpha);
+            pixels[i].b = (unsigned char)((float)buffer[i].z/alpha);
+            pixels[i].a = (unsigned char)buffer[i].w;
+        }
+    }
+}
+
+// Convolve image rows with kernel, from normalized buffer to pixels (worker job callback)
+// NOTE: Kernel taps out of image data are skipped, pixels out of row horizontally wrap to previous/next row
+static void ConvolveImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    int width = job->width;
+    int count = job->width*job->height;
+    int kernelWidth = job->kernelWidth;
+
+    int startRange = -kernelWidth/2;
+    int endRange = (kernelWidth%2 == 0)? kernelWidth/2 : kernelWidth/2 + 1;
+
+    for (int x = start; x < end; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            PixelFloat sum = PixelFloatZero();
+
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int index = width*(x + xk) + (y + yk);
+
+                    if ((index >= 0) && (index < count))
+                    {
+                        float weight = job->kernel[kernelWidth*(xk + kernelWidth/2) + (yk + kernelWidth/2)];
+                        sum = PixelFloatAdd(sum, PixelFloatScale(PixelFloatLoad(&job->buffer[index]), weight));
+                    }
+                }
+            }
+
+            Vector4 result = { 0 };
+            PixelFloatStore(&result, sum);
+
+            if (result.x < 0.0f) result.x = 0.0f;
+            if (result.y < 0.0f) result.y = 0.0f;
+            if (result.z < 0.0f) result.z = 0.0f;
+
+            if (result.x > 1.0f) result.x = 1.0f;
+            if (result.y > 1.0f) result.y = 1.0f;
+            if (result.z > 1.0f) result.z = 1.0f;
+
+            Color *pixel = &job->pixels[width*x + y];
+            pixel->r = (unsigned char)(result.x*255.0f);
+            pixel->g = (unsigned char)(result.y*255.0f);
+            pixel->b = (unsigned char)(result.z*255.0f);
+            pixel->a = (unsigned char)(result.w*255.0f);
+        }
+    }
+}
+
+// Tint image rows, channels computed as (channel*tint)/255 (worker job callback)
+static void TintImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    Color *pixels = job->pixels + start*job->width;
+    Color color = job->tint;
+    int count = (end - start)*job->width;
+    int i = 0;
+
+#if defined(IMAGE_PROCESSING_SIMD_SSE)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tint = _mm_setr_epi16(color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a);
+    const __m128i one = _mm_set1_epi16(1);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixel = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(pixel, zero), tint);
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(pixel, zero), tint);
+
+        // Exact division by 255 for products up to 255*255: (x + 1 + (x >> 8)) >> 8
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        pixels[i].r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+        pixels[i].g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+        pixels[i].b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+        pixels[i].a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+    }
+}
+
+// Map image rows color channels (alpha is kept) through lookup table (worker job callback)
+static void MapImageRows(void *userData, int start, int end)
+{
+    const ImageProcessingJob *job = (const ImageProcessingJob *)userData;
+    Color *pixels = job->pixels;
+
+    for (int i = start*job->width; i < end*job->width; i++)
+    {
+        pixels[i].r = job->table[pixels[i].r];
+        pixels[i].g = job->table[pixels[i].g];
+        pixels[i].b = job->table[pixels[i].b];
+    }
+}
+
+// Draw source image rows into destination image rows (worker job callback)
+static void DrawImageRows(void *userData, int start, int end)
+{
+    const ImageDrawJob *job = (const ImageDrawJob *)userData;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *pSrc = job->srcBase + y*job->srcStride;
+        unsigned char *pDst = job->dstBase + y*job->dstStride;
+
+        // Fast path: Avoid moving pixel by pixel if no blend required and same format
+        if (!job->blendRequired && (job->srcFormat == job->dstFormat)) memcpy(pDst, pSrc, job->width*job->srcBytesPerPixel);
+        else if (job->blendRequired && (job->srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (job->dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            // Fast path: Blend colors directly, no pixel format conversion required
+            const Color *colSrc = (const Color *)pSrc;
+            Color *colDst = (Color *)pDst;
+
+            for (int x = 0; x < job->width; x++) colDst[x] = ColorAlphaBlend(colDst[x], colSrc[x], job->tint);
+        }
+        else
+        {
+            for (int x = 0; x < job->width; x++)
+            {
+                Color colSrc = GetPixelColor((void *)pSrc, job->srcFormat);
+                Color colDst = GetPixelColor(pDst, job->dstFormat);
+                Color blend = colSrc;
+
+                // Fast path: Avoid blend if source has no alpha to blend
+                if (job->blendRequired) blend = ColorAlphaBlend(colDst, colSrc, job->tint);
+
+                SetPixelColor(pDst, blend, job->dstFormat);
+
+                pDst += job->dstBytesPerPixel;
+                pSrc += job->srcBytesPerPixel;
+            }
+        }
+    }
+}
+
+// Load sRGB <--> linear conversion tables (sRGB mipmaps)
+// NOTE: Linear values are 16bit, so 4 values average stays exact and darkest sRGB values are still distinct
+static void LoadSrgbTables(void)
+{
+    // Tables already loaded, or loading on another thread (wait for it)
+    if (!SRGB_TABLES_CAS(&srgbTablesState, 0, 1))
+    {
+        while (!SRGB_TABLES_CAS(&srgbTablesState, 2, 2)) { }
+        return;
+    }
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = i/255.0f;
+        float linear = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+        srgbToLinear[i] = (unsigned short)(linear*65535.0f + 0.5f);
+    }
+
+    for (int i = 0; i < 65536; i++)
+    {
+        float linear = i/65535.0f;
+        float value = (linear <= 0.0031308f)? linear*12.92f : 1.055f*powf(linear, 1.0f/2.4f) - 0.055f;
+        linearToSrgb[i] = (unsigned char)(value*255.0f + 0.5f);
+    }
+
+    SRGB_TABLES_CAS(&srgbTablesState, 1, 2);    // Full barrier, tables written before state is seen as loaded
+}
+
+#if defined(IMAGE_PROCESSING_SIMD_SSE)
+// Downsample RGBA8 row pair, 2x2 box filter, 4 pixels per iteration, returns pixels downsampled
+static int DownsampleRowsRGBA8SSE(const unsigned char *row0, const unsigned char *row1, unsigned char *dst, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i a0 = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(row0 + x*8 + 16));
+        __m128i b0 = _mm_loadu_si128((const __m128i *)(row1 + x*8));
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(row1 + x*8 + 16));
+
+        // Vertical sums as 16bit channels, two pixels per vector
+        __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));     // Pixels 0, 1
+        __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));     // Pixels 2, 3
+        __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));     // Pixels 4, 5
+        __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));     // Pixels 6, 7
+
+        // Horizontal sums of pixel pairs
+        __m128i h0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));      // Pixels 0+1, 2+3
+        __m128i h1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));      // Pixels 4+5, 6+7
+
+        h0 = _mm_srli_epi16(_mm_add_epi16(h0, round), 2);
+        h1 = _mm_srli_epi16(_mm_add_epi16(h1, round), 2);
+
+        _mm_storeu_si128((__m128i *)(dst + x*4), _mm_packus_epi16(h0, h1));
+    }
+
+    return x;
+}
+
+// Downsample GRAYSCALE row pair, 2x2 box filter, 16 pixels per iteration, returns pixels downsampled
+static int DownsampleRowsGraySSE(const unsigned char *row0, const unsigned char *row1, unsigned char *dst, int width)
+{
+    const __m128i mask = _mm_set1_epi16(0xff);
+    const __m128i round = _mm_set1_epi16(2);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i a0 = _mm_loadu_si128((const __m128i *)(row0 + x*2));
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(row0 + x*2 + 16));
+        __m128i b0 = _mm_loadu_si128((const __m128i *)(row1 + x*2));
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(row1 + x*2 + 16));
+
+        // Every 16bit lane holds a horizontal pixel pair: even pixel in low byte, odd pixel in high byte
+        __m128i s0 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a0, mask), _mm_srli_epi16(a0, 8)), _mm_add_epi16(_mm_and_si128(b0, mask), _mm_srli_epi16(b0, 8)));
+        __m128i s1 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a1, mask), _mm_srli_epi16(a1, 8)), _mm_add_epi16(_mm_and_si128(b1, mask), _mm_srli_epi16(b1, 8)));
+
+        s0 = _mm_srli_epi16(_mm_add_epi16(s0, round), 2);
+        s1 = _mm_srli_epi16(_mm_add_epi16(s1, round), 2);
+
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(s0, s1));
+    }
+
+    return x;
+}
+#endif
+
+// Downsample image rows to next mipmap level, 2x2 box filter (worker job callback)
+// NOTE: Previous level sides equal to 1 are not halved, the same row/column is averaged twice
+static void DownsampleImageRows(void *userData, int start, int end)
+{
+    ImageMipmapJob *job = (ImageMipmapJob *)userData;
+    int channels = job->channels;
+    int srcStride = job->srcWidth*channels;
+    int colorChannels = ((channels == 2) || (channels == 4))? channels - 1 : channels;    // Alpha is always averaged linearly
+    int dx = (job->srcWidth > 1)? channels : 0;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row0 = job->src + (size_t)((job->srcHeight > 1)? 2*y : y)*srcStride;
+        const unsigned char *row1 = (job->srcHeight > 1)? row0 + srcStride : row0;
+        unsigned char *dst = job->dst + (size_t)y*job->dstWidth*channels;
+        int x = 0;
+
+        if (job->srgb)
+        {
+            for (; x < job->dstWidth; x++)
+            {
+                const unsigned char *p0 = row0 + x*2*channels;
+                const unsigned char *p1 = row1 + x*2*channels;
+
+                for (int c = 0; c < colorChannels; c++)
+                {
+                    int sum = srgbToLinear[p0[c]] + srgbToLinear[p0[c + dx]] + srgbToLinear[p1[c]] + srgbToLinear[p1[c + dx]];
+                    dst[x*channels + c] = linearToSrgb[(sum + 2) >> 2];
+                }
+
+                if (colorChannels < channels) dst[x*channels + colorChannels] = (unsigned char)((p0[colorChannels] + p0[colorChannels + dx] + p1[colorChannels] + p1[colorChannels + dx] + 2) >> 2);
+            }
+
+            continue;
+        }
+
+#if defined(IMAGE_PROCESSING_SIMD_SSE)
+        if (dx > 0)
+        {
+            if (channels == 4) x = DownsampleRowsRGBA8SSE(row0, row1, dst, job->dstWidth);
+            else if (channels == 1) x = DownsampleRowsGraySSE(row0, row1, dst, job->dstWidth);
+        }
+#endif
+        for (; x < job->dstWidth; x++)
+        {
+            const unsigned char *p0 = row0 + x*2*channels;
+            const unsigned char *p1 = row1 + x*2*channels;
+
+            for (int c = 0; c < channels; c++) dst[x*channels + c] = (unsigned char)((p0[c] + p0[c + dx] + p1[c] + p1[c + dx] + 2) >> 2);
+        }
+    }
+}
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// ETC color modifiers per table (small, large), ETC1/ETC2 spec
+static const int etcModifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+// EAC alpha modifiers per table, ETC2 spec
+static const int eacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+#define BLOCK_ERROR_MAX  0x7fffffff
+
+// Compress rows of 4x4 pixel blocks of one image level
+// NOTE: Blocks over image borders (levels smaller than 4x4) repeat the last pixels row/column
+static void CompressImageBlockRows(void *userData, int start, int end)
+{
+    ImageCompressionJob *job = (ImageCompressionJob *)userData;
+    int blocksPerRow = (job->width + 3)/4;
+    Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksPerRow; bx++)
+        {
+            for (int y = 0; y < 4; y++)
+            {
+                int py = ((by*4 + y) < job->height)? (by*4 + y) : (job->height - 1);
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = ((bx*4 + x) < job->width)? (bx*4 + x) : (job->width - 1);
+                    block[y*4 + x] = job->pixels[py*job->width + px];
+                }
+            }
+
+            unsigned char *output = job->blocks + (by*blocksPerRow + bx)*job->blockSize;
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockDXT(block, output, false, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockDXT(block, output, true, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    CompressBlockAlphaDXT3(block, output);
+                    CompressBlockDXT(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    CompressBlockAlphaDXT5(block, output, job->quality);
+                    CompressBlockDXT(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: CompressBlockETC(block, output, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    CompressBlockAlphaEAC(block, output, job->quality);
+                    CompressBlockETC(block, output + 8, job->quality);
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Quantize color to R5G6B5
+static unsigned short PackColorR5G6B5(const float *color)
+{
+    int r = (int)(color[0]*31.0f/255.0f + 0.5f);
+    int g = (int)(color[1]*63.0f/255.0f + 0.5f);
+    int b = (int)(color[2]*31.0f/255.0f + 0.5f);
+
+    r = (r < 0)? 0 : ((r > 31)? 31 : r);
+    g = (g < 0)? 0 : ((g > 63)? 63 : g);
+    b = (b < 0)? 0 : ((b > 31)? 31 : b);
+
+    return (unsigned short)((r << 11) | (g << 5) | b);
+}
+
+// Get DXT (BC1) block palette from endpoints, 3 colors mode palette has endpoints average and transparent black
+static void GetBlockPaletteDXT(unsigned short color0, unsigned short color1, bool threeColors, int palette[4][3])
+{
+    unsigned short colors[2] = { color0, color1 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        int r = (colors[i] >> 11) & 0x1f;
+        int g = (colors[i] >> 5) & 0x3f;
+        int b = colors[i] & 0x1f;
+
+        palette[i][0] = (r << 3) | (r >> 2);
+        palette[i][1] = (g << 2) | (g >> 4);
+        palette[i][2] = (b << 3) | (b >> 2);
+    }
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (threeColors)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+        else
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+    }
+}
+
+// Select nearest palette color for block pixels, transparent pixels use index 3, returns squared error
+static int SelectBlockIndicesDXT(const Color *block, const bool *opaque, unsigned short color0, unsigned short color1, bool threeColors, unsigned char *indices)
+{
+    int palette[4][3] = { 0 };
+    GetBlockPaletteDXT(color0, color1, threeColors, palette);
+
+    int paletteCount = threeColors? 3 : 4;
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (!opaque[i])
+        {
+            indices[i] = 3;
+            continue;
+        }
+
+        int bestError = BLOCK_ERROR_MAX;
+
+        for (int p = 0; p < paletteCount; p++)
+        {
+            int dr = block[i].r - palette[p][0];
+            int dg = block[i].g - palette[p][1];
+            int db = block[i].b - palette[p][2];
+            int pixelError = dr*dr + dg*dg + db*db;
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                indices[i] = (unsigned char)p;
+            }
+        }
+
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress DXT (BC1) color block
+// NOTE: Endpoints are the block colors bounding box (quality 0) or the extremes along the colors principal axis,
+// refined by least squares fitting to the selected palette entries (quality 1: once, quality 2: until error stops improving)
+static void CompressBlockDXT(const Color *block, unsigned char *output, bool transparent, int quality)
+{
+    bool opaque[16] = { 0 };
+    int count = 0;
+    float mean[3] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        opaque[i] = !transparent || (block[i].a >= 128);
+        if (!opaque[i]) continue;
+
+        mean[0] += block[i].r;
+        mean[1] += block[i].g;
+        mean[2] += block[i].b;
+        count++;
+    }
+
+    bool threeColors = (count < 16);    // Transparent pixels require 3 colors mode, index 3 is transparent black
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+    unsigned char indices[16] = { 0 };
+
+    if (count > 0)
+    {
+        for (int c = 0; c < 3; c++) mean[c] /= count;
+
+        float maxColor[3] = { 0 };
+        float minColor[3] = { 0 };
+
+        if (quality == 0)
+        {
+            // Bounding box, inset to reduce the error of the interpolated colors
+            for (int c = 0; c < 3; c++) { minColor[c] = 255.0f; maxColor[c] = 0.0f; }
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (!opaque[i]) continue;
+
+                float color[3] = { block[i].r, block[i].g, block[i].b };
+                for (int c = 0; c < 3; c++)
+                {
+                    if (color[c] < minColor[c]) minColor[c] = color[c];
+                    if (color[c] > maxColor[c]) maxColor[c] = color[c];
+                }
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                float inset = (maxColor[c] - minColor[c])/16.0f;
+                minColor[c] += inset;
+                maxColor[c] -= inset;
+            }
+        }
+        else
+        {
+            // Principal axis of the colors, power iteration on covariance matrix
+            float covariance[6] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (!opaque[i]) continue;
+
+                float r = block[i].r - mean[0];
+                float g = block[i].g - mean[1];
+                float b = block[i].b - mean[2];
+
+                covariance[0] += r*r; covariance[1] += r*g; covariance[2] += r*b;
+                covariance[3] += g*g; covariance[4] += g*b; covariance[5] += b*b;
+            }
+
+            float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+            for (int iteration = 0; iteration < 8; iteration++)
+            {
+                float x = covariance[0]*axis[0] + covariance[1]*axis[1] + covariance[2]*axis[2];
+                float y = covariance[1]*axis[0] + covariance[3]*axis[1] + covariance[4]*axis[2];
+                float z = covariance[2]*axis[0] + covariance[4]*axis[1] + covariance[5]*axis[2];
+                float length = sqrtf(x*x + y*y + z*z);
+
+                if (length < 1e-6f) break;      // Single color block
+
+                axis[0] = x/length;
+                axis[1] = y/length;
+                axis[2] = z/length;
+            }
+
+            float minT = 0.0f;
+            float maxT = 0.0f;
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (!opaque[i]) continue;
+
+                float t = (block[i].r - mean[0])*axis[0] + (block[i].g - mean[1])*axis[1] + (block[i].b - mean[2])*axis[2];
+                if (t < minT) minT = t;
+                if (t > maxT) maxT = t;
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                minColor[c] = mean[c] + axis[c]*minT;
+                maxColor[c] = mean[c] + axis[c]*maxT;
+            }
+        }
+
+        color0 = PackColorR5G6B5(maxColor);
+        color1 = PackColorR5G6B5(minColor);
+        int error = SelectBlockIndicesDXT(block, opaque, color0, color1, threeColors, indices);
+
+        // Endpoints weight per palette index (color0 weight, color1 weight is 1 - weight)
+        static const float weights[2][4] = { { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f }, { 1.0f, 0.0f, 0.5f, 0.0f } };
+        int refits = (quality == 0)? 0 : ((quality == 1)? 1 : 8);
+
+        for (int iteration = 0; iteration < refits; iteration++)
+        {
+            float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+            float ax[3] = { 0 };
+            float bx[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (!opaque[i]) continue;
+
+                float a = weights[threeColors][indices[i]];
+                float b = 1.0f - a;
+                float color[3] = { block[i].r, block[i].g, block[i].b };
+
+                aa += a*a;
+                bb += b*b;
+                ab += a*b;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    ax[c] += a*color[c];
+                    bx[c] += b*color[c];
+                }
+            }
+
+            float det = aa*bb - ab*ab;
+            if (fabsf(det) < 1e-6f) break;      // All pixels use the same palette entry
+
+            float endpoint0[3] = { 0 };
+            float endpoint1[3] = { 0 };
+
+            for (int c = 0; c < 3; c++)
+            {
+                endpoint0[c] = (ax[c]*bb - bx[c]*ab)/det;
+                endpoint1[c] = (bx[c]*aa - ax[c]*ab)/det;
+            }
+
+            unsigned short refit0 = PackColorR5G6B5(endpoint0);
+            unsigned short refit1 = PackColorR5G6B5(endpoint1);
+            unsigned char refitIndices[16] = { 0 };
+            int refitError = SelectBlockIndicesDXT(block, opaque, refit0, refit1, threeColors, refitIndices);
+
+            if (refitError >= error) break;
+
+            color0 = refit0;
+            color1 = refit1;
+            error = refitError;
+            memcpy(indices, refitIndices, 16);
+        }
+    }
+    else for (int i = 0; i < 16; i++) indices[i] = 3;
+
+    // Endpoints order selects the palette mode: color0 > color1 for 4 colors mode, color0 <= color1 for 3 colors mode
+    if ((!threeColors && (color0 < color1)) || (threeColors && (color0 > color1)))
+    {
+        unsigned short color = color0;
+        color0 = color1;
+        color1 = color;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (indices[i] < 2) indices[i] ^= 1;
+            else if (!threeColors) indices[i] ^= 1;     // Interpolated colors swap too (2 <-> 3)
+        }
+    }
+    else if (!threeColors && (color0 == color1)) memset(indices, 0, 16);    // Decoded as 3 colors mode, index 0 is the only color
+
+    unsigned int bits = 0;
+    for (int i = 0; i < 16; i++) bits |= (unsigned int)indices[i] << (2*i);
+
+    output[0] = (unsigned char)(color0 & 0xff);
+    output[1] = (unsigned char)(color0 >> 8);
+    output[2] = (unsigned char)(color1 & 0xff);
+    output[3] = (unsigned char)(color1 >> 8);
+    output[4] = (unsigned char)(bits & 0xff);
+    output[5] = (unsigned char)((bits >> 8) & 0xff);
+    output[6] = (unsigned char)((bits >> 16) & 0xff);
+    output[7] = (unsigned char)(bits >> 24);
+}
+
+// Compress DXT3 (BC2) explicit alpha block, 4bit alpha per pixel
+static void CompressBlockAlphaDXT3(const Color *block, unsigned char *output)
+{
+    memset(output, 0, 8);
+
+    for (int i = 0; i < 16; i++)
+    {
+        int alpha = (block[i].a*15 + 127)/255;
+        output[i/2] |= (unsigned char)(alpha << (4*(i%2)));
+    }
+}
+
+// Select nearest palette alpha for block pixels, returns squared error
+static int SelectBlockAlphaIndices(const Color *block, const int *palette, unsigned char *indices)
+{
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestError = BLOCK_ERROR_MAX;
+
+        for (int p = 0; p < 8; p++)
+        {
+            int pixelError = (block[i].a - palette[p])*(block[i].a - palette[p]);
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                indices[i] = (unsigned char)p;
+            }
+        }
+
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress DXT5 (BC3) interpolated alpha block
+// NOTE: 8 alpha values mode between block extremes, quality 2 also tries 6 values mode with explicit 0 and 255
+static void CompressBlockAlphaDXT5(const Color *block, unsigned char *output, int quality)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
+    }
+
+    int alpha0 = maxAlpha;
+    int alpha1 = minAlpha;
+    int palette[8] = { alpha0, alpha1 };
+    unsigned char indices[16] = { 0 };
+
+    for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*alpha0 + i*alpha1)/7;
+    int error = SelectBlockAlphaIndices(block, palette, indices);
+
+    if ((quality == 2) && (error > 0))
+    {
+        int minInner = 255;
+        int maxInner = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if ((block[i].a == 0) || (block[i].a == 255)) continue;
+            if (block[i].a < minInner) minInner = block[i].a;
+            if (block[i].a > maxInner) maxInner = block[i].a;
+        }
+
+        if (minInner <= maxInner)
+        {
+            int palette6[8] = { minInner, maxInner, 0, 0, 0, 0, 0, 255 };
+            unsigned char indices6[16] = { 0 };
+
+            for (int i = 1; i < 5; i++) palette6[i + 1] = ((5 - i)*minInner + i*maxInner)/5;
+            int error6 = SelectBlockAlphaIndices(block, palette6, indices6);
+
+            if (error6 < error)
+            {
+                alpha0 = minInner;
+                alpha1 = maxInner;
+                memcpy(indices, indices6, 16);
+            }
+        }
+    }
+
+    unsigned long long bits = 0;
+    for (int i = 0; i < 16; i++) bits |= (unsigned long long)indices[i] << (3*i);
+
+    output[0] = (unsigned char)alpha0;
+    output[1] = (unsigned char)alpha1;
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)((bits >> (8*i)) & 0xff);
+}
+
+// Fit ETC sub-block modifiers table and pixels modifiers for a base color, returns squared error
+static int FitSubBlockETC(const Color *block, const int *pixels, const int *base, int *table, unsigned char *indices)
+{
+    int bestError = BLOCK_ERROR_MAX;
+
+    for (int t = 0; t < 8; t++)
+    {
+        int error = 0;
+        unsigned char tableIndices[8] = { 0 };
+
+        for (int i = 0; (i < 8) && (error < bestError); i++)
+        {
+            Color color = block[pixels[i]];
+            int bestPixelError = BLOCK_ERROR_MAX;
+
+            // NOTE: Modifier index bits: msb selects negative modifier, lsb selects large modifier
+            for (int m = 0; m < 4; m++)
+            {
+                int modifier = (m & 1)? etcModifiers[t][1] : etcModifiers[t][0];
+                if (m & 2) modifier = -modifier;
+
+                int r = base[0] + modifier;
+                int g = base[1] + modifier;
+                int b = base[2] + modifier;
+                r = (r < 0)? 0 : ((r > 255)? 255 : r);
+                g = (g < 0)? 0 : ((g > 255)? 255 : g);
+                b = (b < 0)? 0 : ((b > 255)? 255 : b);
+
+                int pixelError = (color.r - r)*(color.r - r) + (color.g - g)*(color.g - g) + (color.b - b)*(color.b - b);
+
+                if (pixelError < bestPixelError)
+                {
+                    bestPixelError = pixelError;
+                    tableIndices[i] = (unsigned char)m;
+                }
+            }
+
+            error += bestPixelError;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            memcpy(indices, tableIndices, 8);
+        }
+    }
+
+    return bestError;
+}
+
+// Fit ETC sub-block with quantized base color
+static void FitEtcSubBlock(const Color *block, const int *pixels, EtcBlock *etc, int subBlock)
+{
+    int base[3] = { 0 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        int value = etc->base[subBlock][c];
+        base[c] = etc->differential? ((value << 3) | (value >> 2)) : ((value << 4) | value);    // Expand 5bit or 4bit to 8bit
+    }
+
+    etc->error[subBlock] = FitSubBlockETC(block, pixels, base, &etc->table[subBlock], etc->indices[subBlock]);
+}
+
+// Get ETC sub-blocks pixels, sub-blocks are 2x4 (left/right) or 4x2 (top/bottom) if flipped
+static void GetEtcSubBlockPixels(bool flip, int pixels[2][8])
+{
+    int count[2] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        int subBlock = flip? ((i/4) >= 2) : ((i%4) >= 2);
+        pixels[subBlock][count[subBlock]++] = i;
+    }
+}
+
+// Compress ETC1/ETC2 color block, ETC1 individual and differential modes (ETC2 decodes them the same way)
+// NOTE: quality 0 fits left/right sub-blocks only, quality 1 picks the best orientation and mode,
+// quality 2 also refines sub-blocks base colors around their average
+static void CompressBlockETC(const Color *block, unsigned char *output, int quality)
+{
+    EtcBlock best = { 0 };
+    best.error[0] = BLOCK_ERROR_MAX/2;
+    best.error[1] = BLOCK_ERROR_MAX/2;
+    int bestPixels[2][8] = { 0 };
+
+    for (int flip = 0; flip < ((quality == 0)? 1 : 2); flip++)
+    {
+        int pixels[2][8] = { 0 };
+        GetEtcSubBlockPixels(flip, pixels);
+
+        float average[2][3] = { 0 };
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                average[s][0] += block[pixels[s][i]].r/8.0f;
+                average[s][1] += block[pixels[s][i]].g/8.0f;
+                average[s][2] += block[pixels[s][i]].b/8.0f;
+            }
+        }
+
+        // Differential mode: 5bit first base, second base as 3bit signed delta [-4..3]
+        EtcBlock differential = { true, (bool)flip };
+        bool deltaValid = true;
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int c = 0; c < 3; c++) differential.base[s][c] = (int)(average[s][c]*31.0f/255.0f + 0.5f);
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            int delta = differential.base[1][c] - differential.base[0][c];
+            if ((delta < -4) || (delta > 3)) deltaValid = false;
+        }
+
+        // Individual mode: 4bit bases
+        EtcBlock individual = { false, (bool)flip };
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int c = 0; c < 3; c++) individual.base[s][c] = (int)(average[s][c]*15.0f/255.0f + 0.5f);
+        }
+
+        EtcBlock *candidates[2] = { deltaValid? &differential : NULL, (!deltaValid || (quality > 0))? &individual : NULL };
+
+        for (int m = 0; m < 2; m++)
+        {
+            EtcBlock *candidate = candidates[m];
+            if (candidate == NULL) continue;
+
+            FitEtcSubBlock(block, pixels[0], candidate, 0);
+            FitEtcSubBlock(block, pixels[1], candidate, 1);
+
+            if ((candidate->error[0] + candidate->error[1]) < (best.error[0] + best.error[1]))
+            {
+                best = *candidate;
+                memcpy(bestPixels, pixels, sizeof(pixels));
+            }
+        }
+    }
+
+    if (quality == 2)
+    {
+        // Base colors offsets tried: brightness and single channel steps
+        static const int offsets[8][3] = { { 1, 1, 1 }, { -1, -1, -1 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+        int maxBase = best.differential? 31 : 15;
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int o = 0; o < 8; o++)
+            {
+                EtcBlock candidate = best;
+                bool valid = true;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    candidate.base[s][c] += offsets[o][c];
+                    if ((candidate.base[s][c] < 0) || (candidate.base[s][c] > maxBase)) valid = false;
+
+                    int delta = candidate.base[1][c] - candidate.base[0][c];
+                    if (best.differential && ((delta < -4) || (delta > 3))) valid = false;
+                }
+
+                if (!valid) continue;
+
+                FitEtcSubBlock(block, bestPixels[s], &candidate, s);
+                if (candidate.error[s] < best.error[s]) best = candidate;
+            }
+        }
+    }
+
+    unsigned int high = 0;
+    unsigned int low = 0;
+
+    if (best.differential)
+    {
+        high = (best.base[0][0] << 27) | (((best.base[1][0] - best.base[0][0]) & 0x7) << 24) |
+               (best.base[0][1] << 19) | (((best.base[1][1] - best.base[0][1]) & 0x7) << 16) |
+               (best.base[0][2] << 11) | (((best.base[1][2] - best.base[0][2]) & 0x7) << 8);
+    }
+    else
+    {
+        high = (best.base[0][0] << 28) | (best.base[1][0] << 24) |
+               (best.base[0][1] << 20) | (best.base[1][1] << 16) |
+               (best.base[0][2] << 12) | (best.base[1][2] << 8);
+    }
+
+    high |= (best.table[0] << 5) | (best.table[1] << 2) | (best.differential << 1) | best.flip;
+
+    // NOTE: Pixels modifiers are stored in columns order, msb of all pixels first
+    for (int s = 0; s < 2; s++)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            int pixel = bestPixels[s][i];
+            int bit = (pixel%4)*4 + pixel/4;
+
+            low |= (unsigned int)(best.indices[s][i] >> 1) << (bit + 16);
+            low |= (unsigned int)(best.indices[s][i] & 1) << bit;
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        output[i] = (unsigned char)(high >> (24 - 8*i));
+        output[4 + i] = (unsigned char)(low >> (24 - 8*i));
+    }
+}
+
+// Compress ETC2 EAC alpha block
+// NOTE: For every modifiers table, multiplier and base cover the block alpha range,
+// quality 1 also tries the nearest multipliers, quality 2 also the nearest bases
+static void CompressBlockAlphaEAC(const Color *block, unsigned char *output, int quality)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
+    }
+
+    // Single alpha block: table 13 has a zero modifier (index 4)
+    int bestBase = minAlpha;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    unsigned char bestIndices[16] = { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+
+    if (minAlpha != maxAlpha)
+    {
+        int bestError = BLOCK_ERROR_MAX;
+        int multiplierRange = (quality > 0)? 1 : 0;
+        int baseRange = (quality > 1)? 1 : 0;
+
+        for (int t = 0; t < 16; t++)
+        {
+            int tableRange = eacModifiers[t][7] - eacModifiers[t][3];
+            int multiplier = (maxAlpha - minAlpha + tableRange/2)/tableRange;
+            int base = (minAlpha + maxAlpha - (eacModifiers[t][7] + eacModifiers[t][3])*((multiplier > 0)? multiplier : 1) + 1)/2;
+
+            for (int dm = -multiplierRange; dm <= multiplierRange; dm++)
+            {
+                int m = multiplier + dm;
+                if ((m < 1) || (m > 15)) continue;
+
+                for (int db = -baseRange; db <= baseRange; db++)
+                {
+                    int b = base + db;
+                    if ((b < 0) || (b > 255)) continue;
+
+                    int palette[8] = { 0 };
+                    unsigned char indices[16] = { 0 };
+
+                    for (int p = 0; p < 8; p++)
+                    {
+                        int alpha = b + eacModifiers[t][p]*m;
+                        palette[p] = (alpha < 0)? 0 : ((alpha > 255)? 255 : alpha);
+                    }
+
+                    int error = SelectBlockAlphaIndices(block, palette, indices);
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestBase = b;
+                        bestMultiplier = m;
+                        bestTable = t;
+                        memcpy(bestIndices, indices, 16);
+                    }
+                }
+            }
+        }
+    }
+
+    unsigned long long bits = ((unsigned long long)bestBase << 56) | ((unsigned long long)bestMultiplier << 52) | ((unsigned long long)bestTable << 48);
+
+    // NOTE: Pixels indices are stored in columns order
+    for (int i = 0; i < 16; i++)
+    {
+        int pixel = (i%4)*4 + i/4;
+        bits |= (unsigned long long)bestIndices[i] << (45 - 3*pixel);
+    }
+
+    for (int i = 0; i < 8; i++) output[i] = (unsigned char)(bits >> (56 - 8*i));
 }
+#endif      // SUPPORT_IMAGE_COMPRESSION
 
 #endif      // SUPPORT_MODULE_RTEXTURES
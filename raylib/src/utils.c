@@ -7,6 +7,11 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_WORKER_THREADS
+*           Worker threads pool used by RunWorkerJob() to split heavy jobs across cores,
+*           and background thread used by RunWorkerTask() to run tasks without waiting for them,
+*           uses pthreads or Win32 threads, jobs and tasks run on calling thread if not available
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +54,176 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_WORKER_THREADS) && (!defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define WORKER_THREADS_AVAILABLE
+#endif
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+        // NOTE: Win32 threads used on Windows (MSVC and MinGW), declaring required functions to avoid windows.h
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) void *__stdcall CreateSemaphoreA(void *attributes, long initialCount, long maxCount, const char *name);
+        __declspec(dllimport) int __stdcall ReleaseSemaphore(void *semaphore, long releaseCount, long *previousCount);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        #if defined(_MSC_VER)
+            #include <intrin.h>         // Required for: _InterlockedExchangeAdd(), _InterlockedCompareExchange()
+        #endif
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_t, pthread_cond_t
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS            8         // Max number of worker threads
+#endif
+#ifndef MAX_WORKER_TASKS
+    #define MAX_WORKER_TASKS             16         // Max number of queued background tasks, RunWorkerTask() waits when full
+#endif
+#ifndef FRAME_MEMORY_SIZE
+    #define FRAME_MEMORY_SIZE         65536         // Frame memory arena initial size in bytes, grown to frames high-water mark
+#endif
+#ifndef FRAME_MEMORY_MAX_SIZE
+    #define FRAME_MEMORY_MAX_SIZE  16777216         // Frame memory arena max bytes allocated in one frame
+#endif
+
+#define FRAME_MEMORY_ALIGNMENT           16         // Frame memory allocations alignment (SIMD loads)
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #define MEMORY_TABLE_MIN_CAPACITY  1024         // Tracked allocations table initial capacity (power of two)
+
+    // NOTE: Allocations could come from any thread (audio, worker threads), table access is guarded by a spin lock
+    #if defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+        // No threads available, allocations always come from main thread
+        #define MEMORY_LOCK(lock) (void)(lock)
+        #define MEMORY_UNLOCK(lock) (void)(lock)
+    #elif defined(_MSC_VER)
+        #include <intrin.h>                         // Required for: _InterlockedExchange()
+        #define MEMORY_LOCK(lock) while (_InterlockedExchange((volatile long *)(lock), 1) != 0) { }
+        #define MEMORY_UNLOCK(lock) _InterlockedExchange((volatile long *)(lock), 0)
+    #else
+        #define MEMORY_LOCK(lock) while (__sync_lock_test_and_set(lock, 1) != 0) { }
+        #define MEMORY_UNLOCK(lock) __sync_lock_release(lock)
+    #endif
+#endif
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_MSC_VER)
+        #define WORKER_ATOMIC_ADD(ptr, value) _InterlockedExchangeAdd((volatile long *)(ptr), (long)(value))
+        #define WORKER_ATOMIC_CAS(ptr, expected, desired) (_InterlockedCompareExchange((volatile long *)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+    #else
+        #define WORKER_ATOMIC_ADD(ptr, value) __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL)
+        #define WORKER_ATOMIC_CAS(ptr, expected, desired) __sync_bool_compare_and_swap(ptr, expected, desired)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+#if defined(_WIN32)
+typedef void *WorkerThread;
+typedef void *WorkerSemaphore;
+typedef unsigned long (__stdcall *WorkerThreadEntry)(void *arg);
+#else
+typedef pthread_t WorkerThread;
+typedef void *(*WorkerThreadEntry)(void *arg);
+typedef struct WorkerSemaphore {
+    pthread_mutex_t mutex;          // Semaphore counter mutex
+    pthread_cond_t cond;            // Semaphore counter condition
+    int count;                      // Semaphore counter
+} WorkerSemaphore;
+#endif
+
+// Worker threads pool
+// NOTE: Workers wait on jobSemaphore, process batches of items from the current job
+// and post doneSemaphore once there are no more batches available
+typedef struct WorkerPool {
+    WorkerThread threads[MAX_WORKER_THREADS];   // Worker threads
+    int threadCount;                // Worker threads running
+    int requestedCount;             // Threads requested by SetWorkerThreadCount() (including calling thread), 0 for one per core
+    bool initialized;               // Worker threads pool initialized (threadCount could be 0)
+    bool quit;                      // Worker threads exit request
+
+    WorkerSemaphore jobSemaphore;   // Posted once per worker on every job
+    WorkerSemaphore doneSemaphore;  // Posted once per worker when job is done
+    volatile long busy;             // Job in progress, concurrent or nested jobs run on calling thread
+
+    WorkerJobCallback callback;     // Current job callback
+    void *userData;                 // Current job user data
+    int itemCount;                  // Current job items count
+    int batchSize;                  // Current job items per batch
+    volatile long nextItem;         // Next item to be processed, updated atomically
+} WorkerPool;
+
+// Background task
+typedef struct WorkerTask {
+    WorkerTaskCallback callback;    // Task callback
+    void *userData;                 // Task user data
+} WorkerTask;
+
+// Background tasks queue, processed in order by a dedicated thread
+// NOTE: Tasks are expected to be queued from a single thread (usually main thread)
+typedef struct WorkerTaskQueue {
+    WorkerThread thread;            // Background thread
+    bool initialized;               // Background thread initialization attempted
+    bool running;                   // Background thread running
+    bool quit;                      // Background thread exit request
+
+    WorkerSemaphore taskSemaphore;  // Posted once per queued task
+    WorkerSemaphore slotSemaphore;  // Posted once per free queue slot
+    WorkerSemaphore idleSemaphore;  // Posted when all previously queued tasks are completed
+
+    WorkerTask tasks[MAX_WORKER_TASKS]; // Tasks ring buffer
+    int head;                       // Next slot to write, only accessed by the queuing thread
+    int tail;                       // Next slot to read, only accessed by background thread
+} WorkerTaskQueue;
+#endif
+
+// Frame memory overflow block, allocation data follows the header
+typedef struct FrameMemoryBlock {
+    struct FrameMemoryBlock *next;  // Previous overflow block of current frame
+    unsigned int size;              // Block data size
+    unsigned int used;              // Block data bytes allocated
+} FrameMemoryBlock;
+
+// Frame memory arena
+// NOTE: Allocations are bumped on a single block, the ones not fitting go to overflow blocks from the heap,
+// on reset the block grows to the frame high-water mark so following frames don't touch the heap again
+typedef struct FrameMemory {
+    unsigned char *data;            // Arena block
+    unsigned int capacity;          // Arena block size
+    unsigned int used;              // Arena block bytes allocated in current frame
+    unsigned int frameUsed;         // Bytes allocated in current frame, including overflow blocks
+    unsigned int peak;              // Max bytes allocated in one frame
+    unsigned int overflows;         // Overflow blocks allocated, total
+    FrameMemoryBlock *overflow;     // Overflow blocks of current frame (last one first)
+} FrameMemory;
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Tracked allocation, open addressing table entry (linear probing, empty if ptr is NULL)
+typedef struct MemoryEntry {
+    void *ptr;                      // Allocation pointer
+    size_t size;                    // Allocation size in bytes
+    int tag;                        // Allocation memory tag
+} MemoryEntry;
+
+// Tracked allocations
+typedef struct MemoryTracker {
+    volatile long lock;             // Spin lock guarding table and stats
+    MemoryEntry *entries;           // Live allocations table
+    unsigned int capacity;          // Table capacity (power of two)
+    unsigned int count;             // Table entries used
+    MemoryStats stats[MEMORY_TAG_ALL + 1];  // Stats per tag, totals at MEMORY_TAG_ALL
+} MemoryTracker;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -63,15 +232,23 @@ static int logTypeLevel = LOG_INFO;                 // Minimum log type level
 
 static TraceLogCallback traceLog = NULL;            // TraceLog callback function pointer
 static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback function pointer
+static UnloadFileDataCallback unloadFileData = NULL; // UnloadFileData callback function pointer
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static FrameMemory frameMemory = { 0 };             // Frame memory arena, block allocated on first use
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+static MemoryTracker memoryTracker = { 0 };         // Tracked allocations, table allocated on first allocation
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
 void SetTraceLogCallback(TraceLogCallback callback) { traceLog = callback; }              // Set custom trace log
 void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = callback; }  // Set custom file data loader
+void SetUnloadFileDataCallback(UnloadFileDataCallback callback) { unloadFileData = callback; }  // Set custom file data unloader
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
@@ -81,6 +258,11 @@ static AAssetManager *assetManager = NULL;          // Android assets manager po
 static const char *internalDataPath = NULL;         // Android internal data path
 #endif
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static WorkerPool workerPool = { 0 };               // Worker threads pool, initialized on first job
+static WorkerTaskQueue workerTasks = { 0 };         // Background tasks queue, initialized on first task
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -94,6 +276,25 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_MEMORY_TRACKING)
+static unsigned int HashAllocation(const void *ptr);                // Get allocation pointer hash for tracked allocations table
+static void TrackAllocation(void *ptr, size_t size, int tag);       // Add allocation to tracked allocations table
+static MemoryEntry UntrackAllocation(void *ptr);                    // Remove allocation from tracked allocations table, returns removed entry
+#endif
+
+#if defined(WORKER_THREADS_AVAILABLE)
+static void InitWorkerThreads(void);                // Initialize worker threads pool
+static void ProcessWorkerJob(void);                 // Process current job batches until no more available
+static void InitWorkerTasks(void);                  // Initialize background tasks thread
+static void SignalWorkerTasksIdle(void *userData);  // Background task posting idle semaphore, see WaitWorkerTasks()
+static bool CreateWorkerThread(WorkerThread *thread, WorkerThreadEntry entry); // Create a worker thread
+static void JoinWorkerThread(WorkerThread thread);                  // Wait for worker thread exit
+static void InitWorkerSemaphore(WorkerSemaphore *semaphore);        // Initialize semaphore with zero count
+static void CloseWorkerSemaphore(WorkerSemaphore *semaphore);       // Close semaphore
+static void PostWorkerSemaphore(WorkerSemaphore *semaphore, int count); // Increment semaphore count
+static void WaitWorkerSemaphore(WorkerSemaphore *semaphore);        // Wait for semaphore count and decrement it
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -178,6 +379,184 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Get memory allocations stats for a subsystem (MEMORY_TAG_ALL for totals)
+// NOTE: Requires SUPPORT_MEMORY_TRACKING, stats are zero otherwise
+MemoryStats GetMemoryStats(int tag)
+{
+    MemoryStats stats = { 0 };
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    if ((tag >= 0) && (tag <= MEMORY_TAG_ALL))
+    {
+        MEMORY_LOCK(&memoryTracker.lock);
+        stats = memoryTracker.stats[tag];
+        MEMORY_UNLOCK(&memoryTracker.lock);
+    }
+#endif
+
+    return stats;
+}
+
+// Get memory tag subsystem name
+const char *GetMemoryTagName(int tag)
+{
+    static const char *names[MEMORY_TAG_ALL + 1] = { "user", "core", "rlgl", "textures", "text", "models", "audio", "all" };
+
+    if ((tag < 0) || (tag > MEMORY_TAG_ALL)) return "unknown";
+
+    return names[tag];
+}
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Allocate memory, accounted to tag
+void *MemAllocTracked(size_t size, int tag)
+{
+    void *ptr = malloc(size);
+    if (ptr != NULL) TrackAllocation(ptr, size, tag);
+
+    return ptr;
+}
+
+// Allocate zeroed memory, accounted to tag
+void *MemCallocTracked(size_t count, size_t size, int tag)
+{
+    void *ptr = calloc(count, size);
+    if (ptr != NULL) TrackAllocation(ptr, count*size, tag);
+
+    return ptr;
+}
+
+// Reallocate memory, accounted to tag
+// NOTE: Reallocated memory keeps the tag it was allocated with
+void *MemReallocTracked(void *ptr, size_t size, int tag)
+{
+    // Untracked before reallocating, freed address could be returned by an allocation on another thread
+    MemoryEntry entry = UntrackAllocation(ptr);
+    if (entry.ptr != NULL) tag = entry.tag;
+
+    void *newPtr = realloc(ptr, size);
+
+    if (newPtr != NULL) TrackAllocation(newPtr, size, tag);
+    else if ((entry.ptr != NULL) && (size > 0)) TrackAllocation(entry.ptr, entry.size, entry.tag);    // Failed, previous memory still valid
+
+    return newPtr;
+}
+
+// Free memory, untracked pointers are just freed
+void MemFreeTracked(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    UntrackAllocation(ptr);
+    free(ptr);
+}
+#endif
+
+// Frame memory allocator, memory released on EndDrawing()
+// NOTE: Memory is not initialized, allocations are FRAME_MEMORY_ALIGNMENT aligned,
+// returns NULL once FRAME_MEMORY_MAX_SIZE bytes have been allocated in current frame
+// WARNING: Not thread-safe, only main thread is expected to use it
+void *MemAllocFrame(unsigned int size)
+{
+    size = (size + FRAME_MEMORY_ALIGNMENT - 1) & ~(FRAME_MEMORY_ALIGNMENT - 1);
+
+    if ((size == 0) || (size > FRAME_MEMORY_MAX_SIZE - frameMemory.frameUsed)) return NULL;
+
+    if (frameMemory.data == NULL)
+    {
+        frameMemory.capacity = (frameMemory.capacity > FRAME_MEMORY_SIZE)? frameMemory.capacity : FRAME_MEMORY_SIZE;
+        frameMemory.data = (unsigned char *)RL_MALLOC(frameMemory.capacity);
+        if (frameMemory.data == NULL) frameMemory.capacity = 0;
+    }
+
+    void *ptr = NULL;
+
+    if (size <= frameMemory.capacity - frameMemory.used)
+    {
+        ptr = frameMemory.data + frameMemory.used;
+        frameMemory.used += size;
+    }
+    else
+    {
+        FrameMemoryBlock *block = frameMemory.overflow;
+
+        if ((block == NULL) || (size > block->size - block->used))
+        {
+            // NOTE: Small allocations share FRAME_MEMORY_SIZE overflow blocks
+            unsigned int blockSize = (size > FRAME_MEMORY_SIZE)? size : FRAME_MEMORY_SIZE;
+            unsigned int headerSize = (sizeof(FrameMemoryBlock) + FRAME_MEMORY_ALIGNMENT - 1) & ~(FRAME_MEMORY_ALIGNMENT - 1);
+
+            block = (FrameMemoryBlock *)RL_MALLOC(headerSize + blockSize);
+            if (block == NULL) return NULL;
+
+            block->next = frameMemory.overflow;
+            block->size = headerSize + blockSize;
+            block->used = headerSize;
+            frameMemory.overflow = block;
+            frameMemory.overflows++;
+        }
+
+        ptr = (unsigned char *)block + block->used;
+        block->used += size;
+    }
+
+    frameMemory.frameUsed += size;
+
+    return ptr;
+}
+
+// Get frame memory allocator stats
+FrameMemoryStats GetFrameMemoryStats(void)
+{
+    FrameMemoryStats stats = { 0 };
+
+    stats.used = frameMemory.frameUsed;
+    stats.capacity = frameMemory.capacity;
+    stats.peak = (frameMemory.frameUsed > frameMemory.peak)? frameMemory.frameUsed : frameMemory.peak;
+    stats.overflows = frameMemory.overflows;
+
+    return stats;
+}
+
+// Release frame memory allocations, called once per frame by EndDrawing()
+// NOTE: Arena block is grown to fit the whole frame if overflow blocks were required
+void ResetFrameMemory(void)
+{
+    if (frameMemory.frameUsed > frameMemory.peak) frameMemory.peak = frameMemory.frameUsed;
+
+    if (frameMemory.overflow != NULL)
+    {
+        while (frameMemory.overflow != NULL)
+        {
+            FrameMemoryBlock *next = frameMemory.overflow->next;
+            RL_FREE(frameMemory.overflow);
+            frameMemory.overflow = next;
+        }
+
+        unsigned int capacity = (frameMemory.capacity > 0)? frameMemory.capacity : FRAME_MEMORY_SIZE;
+        while ((capacity < frameMemory.frameUsed) && (capacity < FRAME_MEMORY_MAX_SIZE)) capacity *= 2;
+
+        RL_FREE(frameMemory.data);
+        frameMemory.data = NULL;        // Allocated again on next MemAllocFrame()
+        frameMemory.capacity = capacity;
+
+        TRACELOGD("UTILS: Frame memory arena grown to %u bytes", capacity);
+    }
+
+    frameMemory.used = 0;
+    frameMemory.frameUsed = 0;
+}
+
+// Unload frame memory arena (allocated again on next MemAllocFrame())
+void UnloadFrameMemory(void)
+{
+    ResetFrameMemory();
+
+    RL_FREE(frameMemory.data);
+    frameMemory.data = NULL;
+    frameMemory.capacity = 0;
+}
+
 // Load data from file into a buffer
 unsigned char *LoadFileData(const char *fileName, int *dataSize)
 {
@@ -245,8 +624,15 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
 }
 
 // Unload file data allocated by LoadFileData()
+// NOTE: Custom unloader should be set along a custom loader not allocating data with RL_MALLOC()
 void UnloadFileData(unsigned char *data)
 {
+    if (unloadFileData)
+    {
+        unloadFileData(data);
+        return;
+    }
+
     RL_FREE(data);
 }
 
@@ -438,6 +824,124 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Run a job splitting its items in batches across the worker threads
+// NOTE: Calling thread also processes batches and returns when all items have been processed,
+// job runs entirely on calling thread if worker threads are not available or already busy
+void RunWorkerJob(WorkerJobCallback callback, void *userData, int itemCount, int batchSize)
+{
+    if ((callback == NULL) || (itemCount <= 0)) return;
+    if (batchSize <= 0) batchSize = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if ((itemCount > batchSize) && WORKER_ATOMIC_CAS(&workerPool.busy, 0, 1))
+    {
+        if (!workerPool.initialized) InitWorkerThreads();
+
+        if (workerPool.threadCount > 0)
+        {
+            workerPool.callback = callback;
+            workerPool.userData = userData;
+            workerPool.itemCount = itemCount;
+            workerPool.batchSize = batchSize;
+            workerPool.nextItem = 0;
+
+            PostWorkerSemaphore(&workerPool.jobSemaphore, workerPool.threadCount);
+            ProcessWorkerJob();
+            for (int i = 0; i < workerPool.threadCount; i++) WaitWorkerSemaphore(&workerPool.doneSemaphore);
+
+            WORKER_ATOMIC_CAS(&workerPool.busy, 1, 0);
+            return;
+        }
+
+        WORKER_ATOMIC_CAS(&workerPool.busy, 1, 0);
+    }
+#endif
+
+    callback(userData, 0, itemCount);
+}
+
+// Queue a task to run on the background thread, returns without waiting for it
+// NOTE: Tasks run in queuing order, task runs on calling thread if background thread is not available
+void RunWorkerTask(WorkerTaskCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (!workerTasks.initialized) InitWorkerTasks();
+
+    if (workerTasks.running)
+    {
+        WaitWorkerSemaphore(&workerTasks.slotSemaphore);    // Wait for a free slot if queue is full
+
+        workerTasks.tasks[workerTasks.head] = (WorkerTask){ callback, userData };
+        workerTasks.head = (workerTasks.head + 1)%MAX_WORKER_TASKS;
+
+        PostWorkerSemaphore(&workerTasks.taskSemaphore, 1);
+        return;
+    }
+#endif
+
+    callback(userData);
+}
+
+// Wait for all queued background tasks to be completed
+void WaitWorkerTasks(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (!workerTasks.running) return;
+
+    RunWorkerTask(SignalWorkerTasksIdle, NULL);
+    WaitWorkerSemaphore(&workerTasks.idleSemaphore);
+#endif
+}
+
+// Close worker threads, waiting for them to exit
+// NOTE: Queued background tasks are completed first, threads are created again on next job/task if required
+void CloseWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerTasks.running)
+    {
+        WaitWorkerTasks();
+
+        workerTasks.quit = true;
+        PostWorkerSemaphore(&workerTasks.taskSemaphore, 1);
+        JoinWorkerThread(workerTasks.thread);
+
+        CloseWorkerSemaphore(&workerTasks.taskSemaphore);
+        CloseWorkerSemaphore(&workerTasks.slotSemaphore);
+        CloseWorkerSemaphore(&workerTasks.idleSemaphore);
+    }
+
+    memset(&workerTasks, 0, sizeof(WorkerTaskQueue));
+
+    if (!workerPool.initialized) return;
+
+    workerPool.quit = true;
+    PostWorkerSemaphore(&workerPool.jobSemaphore, workerPool.threadCount);
+    for (int i = 0; i < workerPool.threadCount; i++) JoinWorkerThread(workerPool.threads[i]);
+
+    CloseWorkerSemaphore(&workerPool.jobSemaphore);
+    CloseWorkerSemaphore(&workerPool.doneSemaphore);
+
+    workerPool.threadCount = 0;
+    workerPool.quit = false;
+    workerPool.initialized = false;
+#endif
+}
+
+// Set number of threads running worker jobs, including the calling thread (0 for one per available core)
+// NOTE: Worker threads are closed, they are created again with the new count on next job
+void SetWorkerThreadCount(int count)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    CloseWorkerThreads();
+    workerPool.requestedCount = (count > 0)? count : 0;
+#else
+    (void)count;
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -508,3 +1012,313 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Get allocation pointer hash for tracked allocations table
+// NOTE: Low bits are always zero (allocations alignment), discarded before multiplicative hashing
+static unsigned int HashAllocation(const void *ptr)
+{
+    return (unsigned int)((size_t)ptr >> 4)*2654435761u;
+}
+
+// Add allocation to tracked allocations table
+// NOTE: Allocations are not tracked if table can't be grown (out of memory)
+static void TrackAllocation(void *ptr, size_t size, int tag)
+{
+    if ((tag < 0) || (tag >= MEMORY_TAG_ALL)) tag = MEMORY_TAG_USER;
+
+    MEMORY_LOCK(&memoryTracker.lock);
+
+    // Table is grown to keep it half empty at most, probe sequences stay short
+    if ((memoryTracker.count + 1)*2 > memoryTracker.capacity)
+    {
+        unsigned int capacity = (memoryTracker.capacity > 0)? memoryTracker.capacity*2 : MEMORY_TABLE_MIN_CAPACITY;
+        MemoryEntry *entries = (MemoryEntry *)calloc(capacity, sizeof(MemoryEntry));
+
+        if (entries != NULL)
+        {
+            for (unsigned int i = 0; i < memoryTracker.capacity; i++)
+            {
+                if (memoryTracker.entries[i].ptr == NULL) continue;
+
+                unsigned int j = HashAllocation(memoryTracker.entries[i].ptr) & (capacity - 1);
+                while (entries[j].ptr != NULL) j = (j + 1) & (capacity - 1);
+                entries[j] = memoryTracker.entries[i];
+            }
+
+            free(memoryTracker.entries);
+            memoryTracker.entries = entries;
+            memoryTracker.capacity = capacity;
+        }
+    }
+
+    if ((memoryTracker.count + 1)*2 <= memoryTracker.capacity)
+    {
+        unsigned int mask = memoryTracker.capacity - 1;
+        unsigned int i = HashAllocation(ptr) & mask;
+
+        while ((memoryTracker.entries[i].ptr != NULL) && (memoryTracker.entries[i].ptr != ptr)) i = (i + 1) & mask;
+
+        if (memoryTracker.entries[i].ptr == ptr)
+        {
+            // Address was freed with plain free(), previous allocation is gone
+            MemoryEntry *prev = &memoryTracker.entries[i];
+            memoryTracker.stats[prev->tag].liveBytes -= prev->size;
+            memoryTracker.stats[prev->tag].liveCount--;
+            memoryTracker.stats[MEMORY_TAG_ALL].liveBytes -= prev->size;
+            memoryTracker.stats[MEMORY_TAG_ALL].liveCount--;
+        }
+        else memoryTracker.count++;
+
+        memoryTracker.entries[i].ptr = ptr;
+        memoryTracker.entries[i].size = size;
+        memoryTracker.entries[i].tag = tag;
+
+        int tags[2] = { tag, MEMORY_TAG_ALL };
+        for (int t = 0; t < 2; t++)
+        {
+            MemoryStats *stats = &memoryTracker.stats[tags[t]];
+            stats->liveBytes += size;
+            stats->liveCount++;
+            stats->totalBytes += size;
+            stats->totalCount++;
+            if (stats->liveBytes > stats->peakBytes) stats->peakBytes = stats->liveBytes;
+        }
+    }
+
+    MEMORY_UNLOCK(&memoryTracker.lock);
+}
+
+// Remove allocation from tracked allocations table, returns removed entry
+// NOTE: Entry pointer is NULL if allocation was not tracked (allocated with plain malloc())
+static MemoryEntry UntrackAllocation(void *ptr)
+{
+    MemoryEntry entry = { 0 };
+
+    if (ptr == NULL) return entry;
+
+    MEMORY_LOCK(&memoryTracker.lock);
+
+    if (memoryTracker.capacity > 0)
+    {
+        unsigned int mask = memoryTracker.capacity - 1;
+        unsigned int i = HashAllocation(ptr) & mask;
+
+        while ((memoryTracker.entries[i].ptr != NULL) && (memoryTracker.entries[i].ptr != ptr)) i = (i + 1) & mask;
+
+        if (memoryTracker.entries[i].ptr == ptr)
+        {
+            entry = memoryTracker.entries[i];
+
+            memoryTracker.stats[entry.tag].liveBytes -= entry.size;
+            memoryTracker.stats[entry.tag].liveCount--;
+            memoryTracker.stats[MEMORY_TAG_ALL].liveBytes -= entry.size;
+            memoryTracker.stats[MEMORY_TAG_ALL].liveCount--;
+
+            // Following entries of the probe sequence are shifted back, so lookups never stop at the removed slot
+            memoryTracker.entries[i].ptr = NULL;
+
+            for (unsigned int j = (i + 1) & mask; memoryTracker.entries[j].ptr != NULL; j = (j + 1) & mask)
+            {
+                unsigned int k = HashAllocation(memoryTracker.entries[j].ptr) & mask;
+
+                // Entry can be moved to the free slot if its home slot is not between the free slot and itself (cyclically)
+                if (((j > i) && ((k <= i) || (k > j))) || ((j < i) && ((k <= i) && (k > j))))
+                {
+                    memoryTracker.entries[i] = memoryTracker.entries[j];
+                    memoryTracker.entries[j].ptr = NULL;
+                    i = j;
+                }
+            }
+
+            memoryTracker.count--;
+        }
+    }
+
+    MEMORY_UNLOCK(&memoryTracker.lock);
+
+    return entry;
+}
+#endif  // SUPPORT_MEMORY_TRACKING
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker thread main loop
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThreadMain(void *arg)
+#else
+static void *WorkerThreadMain(void *arg)
+#endif
+{
+    (void)arg;
+
+    while (true)
+    {
+        WaitWorkerSemaphore(&workerPool.jobSemaphore);
+        if (workerPool.quit) break;
+
+        ProcessWorkerJob();
+        PostWorkerSemaphore(&workerPool.doneSemaphore, 1);
+    }
+
+    return 0;
+}
+
+// Initialize worker threads pool
+// NOTE: One thread per available core, minus the calling thread
+static void InitWorkerThreads(void)
+{
+    int coreCount = 1;
+
+#if defined(_WIN32)
+    const char *cores = getenv("NUMBER_OF_PROCESSORS");
+    if (cores != NULL) coreCount = atoi(cores);
+#else
+    coreCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    int threadCount = coreCount - 1;
+    if (workerPool.requestedCount > 0) threadCount = workerPool.requestedCount - 1;
+    if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+
+    InitWorkerSemaphore(&workerPool.jobSemaphore);
+    InitWorkerSemaphore(&workerPool.doneSemaphore);
+
+    workerPool.threadCount = 0;
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (!CreateWorkerThread(&workerPool.threads[workerPool.threadCount], WorkerThreadMain)) break;
+        workerPool.threadCount++;
+    }
+
+    workerPool.initialized = true;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Worker threads initialized successfully (%i threads)", workerPool.threadCount);
+}
+
+// Background tasks thread main loop
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerTaskThreadMain(void *arg)
+#else
+static void *WorkerTaskThreadMain(void *arg)
+#endif
+{
+    (void)arg;
+
+    while (true)
+    {
+        WaitWorkerSemaphore(&workerTasks.taskSemaphore);
+        if (workerTasks.quit) break;
+
+        WorkerTask task = workerTasks.tasks[workerTasks.tail];
+        workerTasks.tail = (workerTasks.tail + 1)%MAX_WORKER_TASKS;
+        PostWorkerSemaphore(&workerTasks.slotSemaphore, 1);
+
+        task.callback(task.userData);
+    }
+
+    return 0;
+}
+
+// Initialize background tasks thread
+static void InitWorkerTasks(void)
+{
+    InitWorkerSemaphore(&workerTasks.taskSemaphore);
+    InitWorkerSemaphore(&workerTasks.slotSemaphore);
+    InitWorkerSemaphore(&workerTasks.idleSemaphore);
+    PostWorkerSemaphore(&workerTasks.slotSemaphore, MAX_WORKER_TASKS);
+
+    workerTasks.running = CreateWorkerThread(&workerTasks.thread, WorkerTaskThreadMain);
+    workerTasks.initialized = true;
+
+    if (workerTasks.running) TRACELOG(LOG_INFO, "SYSTEM: Background tasks thread initialized successfully");
+    else
+    {
+        CloseWorkerSemaphore(&workerTasks.taskSemaphore);
+        CloseWorkerSemaphore(&workerTasks.slotSemaphore);
+        CloseWorkerSemaphore(&workerTasks.idleSemaphore);
+
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to create background tasks thread, tasks run on calling thread");
+    }
+}
+
+static void SignalWorkerTasksIdle(void *userData)
+{
+    (void)userData;
+
+    PostWorkerSemaphore(&workerTasks.idleSemaphore, 1);
+}
+
+// Process current job batches until no more available
+static void ProcessWorkerJob(void)
+{
+    while (true)
+    {
+        int start = (int)WORKER_ATOMIC_ADD(&workerPool.nextItem, workerPool.batchSize);
+        if (start >= workerPool.itemCount) break;
+
+        int end = start + workerPool.batchSize;
+        if (end > workerPool.itemCount) end = workerPool.itemCount;
+
+        workerPool.callback(workerPool.userData, start, end);
+    }
+}
+
+#if defined(_WIN32)
+static bool CreateWorkerThread(WorkerThread *thread, WorkerThreadEntry entry)
+{
+    *thread = CreateThread(NULL, 0, entry, NULL, 0, NULL);
+    return (*thread != NULL);
+}
+
+static void JoinWorkerThread(WorkerThread thread)
+{
+    WaitForSingleObject(thread, 0xFFFFFFFF);    // INFINITE
+    CloseHandle(thread);
+}
+
+static void InitWorkerSemaphore(WorkerSemaphore *semaphore) { *semaphore = CreateSemaphoreA(NULL, 0, 0x7FFFFFFF, NULL); }
+static void CloseWorkerSemaphore(WorkerSemaphore *semaphore) { CloseHandle(*semaphore); }
+static void PostWorkerSemaphore(WorkerSemaphore *semaphore, int count) { if (count > 0) ReleaseSemaphore(*semaphore, count, NULL); }
+static void WaitWorkerSemaphore(WorkerSemaphore *semaphore) { WaitForSingleObject(*semaphore, 0xFFFFFFFF); }
+#else
+static bool CreateWorkerThread(WorkerThread *thread, WorkerThreadEntry entry)
+{
+    return (pthread_create(thread, NULL, entry, NULL) == 0);
+}
+
+static void JoinWorkerThread(WorkerThread thread)
+{
+    pthread_join(thread, NULL);
+}
+
+static void InitWorkerSemaphore(WorkerSemaphore *semaphore)
+{
+    pthread_mutex_init(&semaphore->mutex, NULL);
+    pthread_cond_init(&semaphore->cond, NULL);
+    semaphore->count = 0;
+}
+
+static void CloseWorkerSemaphore(WorkerSemaphore *semaphore)
+{
+    pthread_cond_destroy(&semaphore->cond);
+    pthread_mutex_destroy(&semaphore->mutex);
+}
+
+static void PostWorkerSemaphore(WorkerSemaphore *semaphore, int count)
+{
+    pthread_mutex_lock(&semaphore->mutex);
+    semaphore->count += count;
+    if (count > 1) pthread_cond_broadcast(&semaphore->cond);
+    else pthread_cond_signal(&semaphore->cond);
+    pthread_mutex_unlock(&semaphore->mutex);
+}
+
+static void WaitWorkerSemaphore(WorkerSemaphore *semaphore)
+{
+    pthread_mutex_lock(&semaphore->mutex);
+    while (semaphore->count == 0) pthread_cond_wait(&semaphore->cond, &semaphore->mutex);
+    semaphore->count--;
+    pthread_mutex_unlock(&semaphore->mutex);
+}
+#endif
+#endif  // WORKER_THREADS_AVAILABLE
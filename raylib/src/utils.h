@@ -27,6 +27,10 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #include <stddef.h>                     // Required for: size_t
+#endif
+
 #if defined(PLATFORM_ANDROID)
     #include <stdio.h>                      // Required for: FILE
     #include <android/asset_manager.h>      // Required for: AAssetManager
@@ -52,10 +56,32 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Tracked memory allocators replace raylib.h ones, allocations are accounted to the including module tag
+// NOTE: Modules define RL_MEMORY_TAG before including this header, included external libraries
+// remapped to RL_MALLOC/RL_FREE are accounted to the module too
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #ifndef RL_MEMORY_TAG
+        #define RL_MEMORY_TAG MEMORY_TAG_USER
+    #endif
+
+    #undef RL_MALLOC
+    #undef RL_CALLOC
+    #undef RL_REALLOC
+    #undef RL_FREE
+    #define RL_MALLOC(sz)       MemAllocTracked(sz, RL_MEMORY_TAG)
+    #define RL_CALLOC(n,sz)     MemCallocTracked(n, sz, RL_MEMORY_TAG)
+    #define RL_REALLOC(ptr,sz)  MemReallocTracked(ptr, sz, RL_MEMORY_TAG)
+    #define RL_FREE(ptr)        MemFreeTracked(ptr)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Worker job callback, processes job items in range [start, end)
+typedef void (*WorkerJobCallback)(void *userData, int start, int end);
+
+// Worker task callback, runs on the background thread
+typedef void (*WorkerTaskCallback)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +100,22 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+void RunWorkerJob(WorkerJobCallback callback, void *userData, int itemCount, int batchSize); // Run job items in batches across worker threads, waits for completion
+void RunWorkerTask(WorkerTaskCallback callback, void *userData);        // Queue task on background thread, returns without waiting (tasks run in order)
+void WaitWorkerTasks(void);                                             // Wait for all queued background tasks to be completed
+void CloseWorkerThreads(void);                                          // Close worker threads and background thread (created again on next job/task)
+void SetWorkerThreadCount(int count);                                   // Set threads running worker jobs, including calling thread (0: one per core)
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+void *MemAllocTracked(size_t size, int tag);                            // Allocate memory, accounted to tag
+void *MemCallocTracked(size_t count, size_t size, int tag);             // Allocate zeroed memory, accounted to tag
+void *MemReallocTracked(void *ptr, size_t size, int tag);               // Reallocate memory, accounted to tag
+void MemFreeTracked(void *ptr);                                         // Free memory, untracked pointers are just freed
+#endif
+
+void ResetFrameMemory(void);                                            // Release frame memory allocations, called once per frame by EndDrawing()
+void UnloadFrameMemory(void);                                           // Unload frame memory arena (allocated again on next MemAllocFrame())
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,129 @@
+#include "atlas.h"
+#include "external/stb_rect_pack.h" // Implementation is compiled into raylib (rtext)
+#include <stddef.h>
+
+static int AlignAtlasSize(int size) {
+    return (size + ATLAS_ALIGNMENT - 1) / ATLAS_ALIGNMENT * ATLAS_ALIGNMENT;
+}
+
+static int ClampAtlasCoord(int value, int max) {
+    return (value < 0) ? 0 : ((value > max) ? max : value);
+}
+
+// Fill the whole packed rect, the image edges are repeated up to the rect border so that
+// mip levels averaging aligned blocks only see this image
+static void BlitAtlasImage(Image* page, const Image* image, const stbrp_rect* rect) {
+    Color* dst = (Color*)page->data;
+    const Color* src = (const Color*)image->data;
+
+    for (int y = 0; y < rect->h; y++) {
+        int sy = ClampAtlasCoord(y - ATLAS_GUTTER, image->height - 1);
+        Color* row = dst + (rect->y + y) * page->width + rect->x;
+        for (int x = 0; x < rect->w; x++) row[x] = src[sy * image->width + ClampAtlasCoord(x - ATLAS_GUTTER, image->width - 1)];
+    }
+}
+
+TextureAtlas LoadTextureAtlas(const Image* images, int imageCount, int pageSize) {
+    TextureAtlas atlas = { 0 };
+    if (imageCount <= 0) return atlas;
+
+    atlas.regions = (AtlasRegion*)MemAlloc(imageCount * sizeof(AtlasRegion));
+    atlas.regionCount = imageCount;
+
+    stbrp_rect* rects = (stbrp_rect*)MemAlloc(imageCount * sizeof(stbrp_rect));
+    stbrp_node* nodes = (stbrp_node*)MemAlloc(pageSize * sizeof(stbrp_node));
+    Image* pixels = (Image*)MemAlloc(imageCount * sizeof(Image));
+
+    int skipped = 0;
+    for (int i = 0; i < imageCount; i++) {
+        // Pages are RGBA8, other formats are converted on a copy
+        pixels[i] = ImageCopy(images[i]);
+        if (pixels[i].format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(&pixels[i], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        atlas.regions[i].page = -1;
+
+        // Compressed formats are left as they are by ImageFormat(), those images are skipped as 0x0 rects (page -1)
+        if ((pixels[i].data == NULL) || (pixels[i].format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) {
+            TraceLog(LOG_WARNING, "ATLAS: Image %i skipped, format %i can't be converted to RGBA8", i, pixels[i].format);
+            rects[i] = (stbrp_rect){ i, 0, 0, 0, 0, 0 };
+            skipped++;
+            continue;
+        }
+
+        rects[i] = (stbrp_rect){ i, AlignAtlasSize(pixels[i].width + 2 * ATLAS_GUTTER), AlignAtlasSize(pixels[i].height + 2 * ATLAS_GUTTER), 0, 0, 0 };
+    }
+
+    int remaining = imageCount - skipped;
+    while ((remaining > 0) && (atlas.pageCount < ATLAS_MAX_PAGES)) {
+        // Only the images not packed yet go into this page, already packed ones are skipped as 0x0 rects
+        stbrp_context context;
+        stbrp_init_target(&context, pageSize, pageSize, nodes, pageSize);
+        stbrp_pack_rects(&context, rects, imageCount);
+
+        Image page = GenImageColor(pageSize, pageSize, BLANK);
+        int packed = 0;
+
+        for (int i = 0; i < imageCount; i++) {
+            if (!rects[i].was_packed || (rects[i].w == 0)) continue;
+
+            BlitAtlasImage(&page, &pixels[i], &rects[i]);
+
+            AtlasRegion* region = &atlas.regions[i];
+            region->page = atlas.pageCount;
+            region->source = (Rectangle){ (float)(rects[i].x + ATLAS_GUTTER), (float)(rects[i].y + ATLAS_GUTTER), (float)pixels[i].width, (float)pixels[i].height };
+            region->uv = (Rectangle){ region->source.x / pageSize, region->source.y / pageSize, region->source.width / pageSize, region->source.height / pageSize };
+
+            rects[i].w = 0;
+            rects[i].h = 0;
+            packed++;
+        }
+
+        if (packed == 0) {
+            UnloadImage(page);
+            break;
+        }
+
+        // Mipmaps generated on the CPU, box filtered aligned blocks with colors averaged in linear space
+        ImageMipmapsEx(&page, true);
+        Texture2D texture = LoadTextureFromImage(page);
+        SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+        SetTextureWrap(texture, TEXTURE_WRAP_CLAMP);
+        atlas.pages[atlas.pageCount++] = texture;
+
+        UnloadImage(page);
+        remaining -= packed;
+    }
+
+    if (remaining > 0) TraceLog(LOG_WARNING, "ATLAS: %i images didn't fit in %i pages of %ix%i", remaining, ATLAS_MAX_PAGES, pageSize, pageSize);
+    TraceLog(LOG_INFO, "ATLAS: Packed %i images in %i pages of %ix%i", imageCount - skipped - remaining, atlas.pageCount, pageSize, pageSize);
+
+    for (int i = 0; i < imageCount; i++) UnloadImage(pixels[i]);
+    MemFree(pixels);
+    MemFree(nodes);
+    MemFree(rects);
+
+    return atlas;
+}
+
+void UnloadTextureAtlas(TextureAtlas atlas) {
+    for (int i = 0; i < atlas.pageCount; i++) UnloadTexture(atlas.pages[i]);
+    MemFree(atlas.regions);
+}
+
+void RemapMeshTexcoords(Mesh* mesh, AtlasRegion region) {
+    if ((mesh->texcoords == NULL) || (region.page < 0)) return;
+
+    for (int i = 0; i < mesh->vertexCount; i++) {
+        mesh->texcoords[i * 2 + 0] = region.uv.x + mesh->texcoords[i * 2 + 0] * region.uv.width;
+        mesh->texcoords[i * 2 + 1] = region.uv.y + mesh->texcoords[i * 2 + 1] * region.uv.height;
+    }
+
+    // Buffer 1 holds the texcoords (see UploadMesh())
+    if ((mesh->vboId != NULL) && (mesh->vboId[1] != 0)) UpdateMeshBuffer(*mesh, 1, mesh->texcoords, mesh->vertexCount * 2 * sizeof(float), 0);
+}
+
+void DrawAtlasRegion(TextureAtlas atlas, int index, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    if ((index < 0) || (index >= atlas.regionCount) || (atlas.regions[index].page < 0)) return;
+
+    AtlasRegion region = atlas.regions[index];
+    DrawTexturePro(atlas.pages[region.page], region.source, dest, origin, rotation, tint);
+}
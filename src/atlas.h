@@ -0,0 +1,34 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include "raylib.h"
+
+#define ATLAS_MAX_PAGES 4       // Images that don't fit a page go to the next one
+#define ATLAS_GUTTER 4          // Edge pixels repeated around every image, so filtering never reads a neighbour
+#define ATLAS_ALIGNMENT 8       // Images are placed on 8 pixel boundaries, mip levels 1..3 don't mix images
+
+// Where an image ended up in the atlas
+typedef struct AtlasRegion {
+    int page;               // Atlas page texture
+    Rectangle source;       // Image rectangle in the page, in pixels (for DrawTexturePro())
+    Rectangle uv;           // Image rectangle in the page, normalized (for mesh texcoords)
+} AtlasRegion;
+
+typedef struct TextureAtlas {
+    Texture2D pages[ATLAS_MAX_PAGES];
+    int pageCount;
+    AtlasRegion* regions;   // One per packed image, in the order they were given
+    int regionCount;
+} TextureAtlas;
+
+// Pack images into square pages of pageSize pixels (power of two), pages are mipmapped with trilinear filtering
+// NOTE: Texcoords must stay in [0..1] once remapped, repeating textures (terrain ground) can't be atlased
+TextureAtlas LoadTextureAtlas(const Image* images, int imageCount, int pageSize);
+void UnloadTextureAtlas(TextureAtlas atlas);
+
+// Remap mesh texcoords into an atlas region (updated on the GPU too if the mesh is uploaded)
+void RemapMeshTexcoords(Mesh* mesh, AtlasRegion region);
+// Draw an atlased image, same as DrawTexturePro() with the whole image as source
+void DrawAtlasRegion(TextureAtlas atlas, int index, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+#endif
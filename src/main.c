@@ -5,6 +5,7 @@
 #include "world.h"
 #include "screens.h"
 #include "ui.h"
+#include "pack.h"
 
 int main(void)
 {
@@ -18,6 +19,9 @@ int main(void)
     InitWindow(screenWidth, screenHeight, "Doogo - A Dog's Life");
     InitAudioDevice();
 
+    // Assets are read from the packed archive when available, loose files otherwise
+    MountPack(PACK_FILE_NAME);
+
     // Disable the default ESC key behavior so we can use it for Pause
     SetExitKey(KEY_NULL);
 
@@ -42,7 +46,7 @@ int main(void)
     World world = { 0 };
     InitWorld(&world);
 
-    Sound barkSound = LoadSound("asset/audio/bark.mp3");
+    Sound barkSound = LoadSound("assets/audio/bark.mp3");
 
     SetTargetFPS(60); // Set our game to run at 60 frames-per-second
     
@@ -56,6 +60,10 @@ int main(void)
         // ----------------------------------------------------------------------------------
         // Update Logic (Process Input and Math)
         // ----------------------------------------------------------------------------------
+#if defined(DOOGO_DEBUG)
+        if (IsKeyPressed(KEY_F3)) gameState.showMemoryOverlay = !gameState.showMemoryOverlay;
+#endif
+
         switch(gameState.currentScreen)
         {
             case SCREEN_TITLE:
@@ -104,6 +112,8 @@ int main(void)
                 default: break;
             }
 
+            if (gameState.showMemoryOverlay) DrawMemoryOverlay(GetScreenWidth() - 310, 10);
+
         EndDrawing();
         // ----------------------------------------------------------------------------------
     }
@@ -112,7 +122,12 @@ int main(void)
     // De-Initialization
     // --------------------------------------------------------------------------------------
     UnloadSound(barkSound);
+    UnloadWorld(&world);
     CloseAudioDevice();
+    UnmountPack();
+#if defined(DOOGO_DEBUG)
+    TraceMemoryStats();   // Anything still live here (besides raylib's own) is a leak
+#endif
     CloseWindow();        // Close window and OpenGL context
     // --------------------------------------------------------------------------------------
 
@@ -0,0 +1,309 @@
+#include "pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+// Declared here instead of including windows.h, it collides with raylib names (CloseWindow, DrawText...)
+__declspec(dllimport) void* __stdcall CreateFileA(const char* fileName, unsigned long access, unsigned long shareMode, void* security, unsigned long creation, unsigned long flags, void* templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void* file, long long* size);
+__declspec(dllimport) void* __stdcall CreateFileMappingA(void* file, void* security, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char* name);
+__declspec(dllimport) void* __stdcall MapViewOfFile(void* mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void* address);
+__declspec(dllimport) int __stdcall CloseHandle(void* handle);
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Mounted archive, mapped copy-on-write so loaders writing into their input can't corrupt it
+static struct {
+    unsigned char* data;
+    size_t size;
+    const PackEntry* entries;
+    unsigned int entryCount;
+#if defined(_WIN32)
+    void* file;
+    void* mapping;
+#endif
+} pack = { 0 };
+
+static void* MapPackFile(const char* fileName, size_t* size) {
+#if defined(_WIN32)
+    void* invalidHandle = (void*)(long long)-1;
+    pack.file = CreateFileA(fileName, 0x80000000 /*GENERIC_READ*/, 1 /*FILE_SHARE_READ*/, NULL, 3 /*OPEN_EXISTING*/, 0x80 /*FILE_ATTRIBUTE_NORMAL*/, NULL);
+    if (pack.file == invalidHandle) return NULL;
+
+    long long fileSize = 0;
+    if (!GetFileSizeEx(pack.file, &fileSize) || (fileSize == 0)) { CloseHandle(pack.file); return NULL; }
+
+    pack.mapping = CreateFileMappingA(pack.file, NULL, 0x08 /*PAGE_WRITECOPY*/, 0, 0, NULL);
+    if (pack.mapping == NULL) { CloseHandle(pack.file); return NULL; }
+
+    void* data = MapViewOfFile(pack.mapping, 0x01 /*FILE_MAP_COPY*/, 0, 0, 0);
+    if (data == NULL) { CloseHandle(pack.mapping); CloseHandle(pack.file); return NULL; }
+
+    *size = (size_t)fileSize;
+    return data;
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat info;
+    if ((fstat(fd, &info) != 0) || (info.st_size == 0)) { close(fd); return NULL; }
+
+    void* data = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // Mapping keeps its own reference to the file
+    if (data == MAP_FAILED) return NULL;
+
+    *size = (size_t)info.st_size;
+    return data;
+#endif
+}
+
+static void UnmapPackFile(void) {
+#if defined(_WIN32)
+    UnmapViewOfFile(pack.data);
+    CloseHandle(pack.mapping);
+    CloseHandle(pack.file);
+#else
+    munmap(pack.data, pack.size);
+#endif
+}
+
+static int ComparePackEntry(const void* path, const void* entry) {
+    return strcmp((const char*)path, ((const PackEntry*)entry)->path);
+}
+
+// Archive paths use '/' and no leading "./", requests are normalized the same way
+static void NormalizePackPath(const char* fileName, char* path) {
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    int i = 0;
+    for (; (fileName[i] != '\0') && (i < PACK_PATH_SIZE - 1); i++) path[i] = (fileName[i] == '\\') ? '/' : fileName[i];
+    path[i] = '\0';
+}
+
+static const PackEntry* FindPackEntry(const char* fileName) {
+    if (strlen(fileName) >= PACK_PATH_SIZE) return NULL;
+
+    char path[PACK_PATH_SIZE];
+    NormalizePackPath(fileName, path);
+
+    return bsearch(path, pack.entries, pack.entryCount, sizeof(PackEntry), ComparePackEntry);
+}
+
+// Assets missing from the archive (or not packed yet) are read from disk
+static unsigned char* LoadLooseFileData(const char* fileName, int* dataSize) {
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "PACK: [%s] Failed to open file", fileName);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char* data = (size > 0) ? (unsigned char*)MemAlloc((unsigned int)size) : NULL;
+    if (data != NULL) *dataSize = (int)fread(data, 1, (size_t)size, file);
+    fclose(file);
+
+    return data;
+}
+
+static unsigned char* LoadPackFileData(const char* fileName, int* dataSize) {
+    const PackEntry* entry = FindPackEntry(fileName);
+    if (entry == NULL) return LoadLooseFileData(fileName, dataSize);
+
+    unsigned char* blob = pack.data + entry->offset;
+
+    if (entry->flags & PACK_FLAG_COMPRESSED) {
+        unsigned char* data = DecompressData(blob, (int)entry->size, dataSize);
+        if ((data != NULL) && (*dataSize != (int)entry->rawSize)) {
+            TraceLog(LOG_WARNING, "PACK: [%s] Decompressed size mismatch", fileName);
+            MemFree(data);
+            *dataSize = 0;
+            return NULL;
+        }
+        return data;
+    }
+
+    // Zero-copy, loaders read straight from the mapped archive
+    *dataSize = (int)entry->rawSize;
+    return blob;
+}
+
+static void UnloadPackFileData(unsigned char* data) {
+    if ((data >= pack.data) && (data < pack.data + pack.size)) return; // Part of the mapping, nothing to free
+    MemFree(data);
+}
+
+// Text loaders modify and free the returned string, always a copy
+static char* LoadPackFileText(const char* fileName) {
+    int dataSize = 0;
+    unsigned char* data = LoadPackFileData(fileName, &dataSize);
+    if (data == NULL) return NULL;
+
+    char* text = (char*)MemAlloc(dataSize + 1);
+    memcpy(text, data, dataSize);
+    text[dataSize] = '\0';
+
+    UnloadPackFileData(data);
+    return text;
+}
+
+bool MountPack(const char* fileName) {
+    if (pack.data != NULL) UnmountPack();
+
+    size_t size = 0;
+    unsigned char* data = MapPackFile(fileName, &size);
+    if (data == NULL) {
+        TraceLog(LOG_INFO, "PACK: [%s] Archive not found, loading assets from disk", fileName);
+        return false;
+    }
+
+    pack.data = data;
+    pack.size = size;
+
+    const PackHeader* header = (const PackHeader*)data;
+    bool valid = (size >= sizeof(PackHeader)) && (memcmp(header->magic, "DPAK", 4) == 0) && (header->version == PACK_VERSION) &&
+                 (header->entryCount <= (size - sizeof(PackHeader)) / sizeof(PackEntry));
+
+    if (valid) {
+        pack.entries = (const PackEntry*)(data + sizeof(PackHeader));
+        pack.entryCount = header->entryCount;
+
+        for (unsigned int i = 0; i < pack.entryCount; i++) {
+            const PackEntry* entry = &pack.entries[i];
+            if ((entry->path[PACK_PATH_SIZE - 1] != '\0') || (entry->offset > size) || (entry->size > size - entry->offset)) valid = false;
+            // Stored assets are returned as the blob itself, their size must be the blob size
+            if (!(entry->flags & PACK_FLAG_COMPRESSED) && (entry->rawSize != entry->size)) valid = false;
+            if (entry->rawSize > PACK_MAX_RAW_SIZE) valid = false;
+        }
+    }
+
+    if (!valid) {
+        TraceLog(LOG_WARNING, "PACK: [%s] Invalid archive, loading assets from disk", fileName);
+        UnmapPackFile();
+        memset(&pack, 0, sizeof(pack));
+        return false;
+    }
+
+    SetLoadFileDataCallback(LoadPackFileData);
+    SetUnloadFileDataCallback(UnloadPackFileData);
+    SetLoadFileTextCallback(LoadPackFileText);
+
+    TraceLog(LOG_INFO, "PACK: [%s] Archive mounted (%u assets, %u KB)", fileName, pack.entryCount, (unsigned int)(size / 1024));
+    return true;
+}
+
+void UnmountPack(void) {
+    if (pack.data == NULL) return;
+
+    SetLoadFileDataCallback(NULL);
+    SetUnloadFileDataCallback(NULL);
+    SetLoadFileTextCallback(NULL);
+
+    UnmapPackFile();
+    memset(&pack, 0, sizeof(pack));
+}
+
+static int ComparePackEntries(const void* a, const void* b) {
+    return strcmp(((const PackEntry*)a)->path, ((const PackEntry*)b)->path);
+}
+
+static bool WritePackPadding(FILE* file, long* offset) {
+    static const unsigned char zeros[PACK_ALIGNMENT] = { 0 };
+    long padding = (PACK_ALIGNMENT - (*offset % PACK_ALIGNMENT)) % PACK_ALIGNMENT;
+    *offset += padding;
+    return fwrite(zeros, 1, (size_t)padding, file) == (size_t)padding;
+}
+
+bool BuildPack(const char* dirPath, const char* fileName, bool compress) {
+    FilePathList files = LoadDirectoryFilesEx(dirPath, NULL, true);
+    if (files.count == 0) {
+        TraceLog(LOG_WARNING, "PACK: [%s] No files to pack", dirPath);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    PackEntry* entries = (PackEntry*)MemAlloc(files.count * sizeof(PackEntry));
+    for (unsigned int i = 0; i < files.count; i++) {
+        if (strlen(files.paths[i]) >= PACK_PATH_SIZE) {
+            TraceLog(LOG_WARNING, "PACK: [%s] Path too long, max %i characters", files.paths[i], PACK_PATH_SIZE - 1);
+            MemFree(entries);
+            UnloadDirectoryFiles(files);
+            return false;
+        }
+        NormalizePackPath(files.paths[i], entries[i].path);
+    }
+
+    // Index sorted by path, assets are looked up with a binary search
+    qsort(entries, files.count, sizeof(PackEntry), ComparePackEntries);
+
+    FILE* file = fopen(fileName, "wb");
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "PACK: [%s] Failed to create archive", fileName);
+        MemFree(entries);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    PackHeader header = { { 'D', 'P', 'A', 'K' }, PACK_VERSION, files.count, 0 };
+    long offset = (long)(sizeof(PackHeader) + files.count * sizeof(PackEntry));
+    bool success = fseek(file, offset, SEEK_SET) == 0;
+
+    for (unsigned int i = 0; success && (i < files.count); i++) {
+        success = WritePackPadding(file, &offset);
+
+        int rawSize = 0;
+        unsigned char* data = LoadFileData(entries[i].path, &rawSize);
+        if (data == NULL) { success = false; break; }
+        if (rawSize > PACK_MAX_RAW_SIZE) {
+            TraceLog(LOG_WARNING, "PACK: [%s] Asset too big, max %i MB", entries[i].path, PACK_MAX_RAW_SIZE / (1024 * 1024));
+            UnloadFileData(data);
+            success = false;
+            break;
+        }
+
+        unsigned char* blob = data;
+        int size = rawSize;
+        unsigned char* compData = NULL;
+
+        // Already compressed formats (mp3, png...) don't shrink, keep them stored for zero-copy loading
+        if (compress && (rawSize > 0)) {
+            int compSize = 0;
+            compData = CompressData(data, rawSize, &compSize);
+            if ((compData != NULL) && (compSize < rawSize - rawSize / 10)) {
+                blob = compData;
+                size = compSize;
+                entries[i].flags |= PACK_FLAG_COMPRESSED;
+            }
+        }
+
+        entries[i].offset = (unsigned int)offset;
+        entries[i].size = (unsigned int)size;
+        entries[i].rawSize = (unsigned int)rawSize;
+
+        success = success && (fwrite(blob, 1, (size_t)size, file) == (size_t)size);
+        offset += size;
+
+        if (compData != NULL) MemFree(compData);
+        UnloadFileData(data);
+    }
+
+    success = success && (fseek(file, 0, SEEK_SET) == 0) &&
+              (fwrite(&header, sizeof(PackHeader), 1, file) == 1) &&
+              (fwrite(entries, sizeof(PackEntry), files.count, file) == files.count);
+    fclose(file);
+
+    if (success) TraceLog(LOG_INFO, "PACK: [%s] Archive built (%u assets, %li KB)", fileName, files.count, offset / 1024);
+    else TraceLog(LOG_WARNING, "PACK: [%s] Failed to build archive", fileName);
+
+    MemFree(entries);
+    UnloadDirectoryFiles(files);
+    return success;
+}
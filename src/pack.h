@@ -0,0 +1,38 @@
+#ifndef PACK_H
+#define PACK_H
+
+#include "raylib.h"
+
+#define PACK_FILE_NAME "doogo.pak"  // Archive mounted at startup, built from assets/ by tools/pack_builder.c
+#define PACK_VERSION 1
+#define PACK_ALIGNMENT 16           // Blob alignment inside the archive
+#define PACK_PATH_SIZE 116          // Max asset path length (including '\0')
+#define PACK_MAX_RAW_SIZE (64 * 1024 * 1024)    // Max asset size, compressed assets can't decompress past it (raylib MAX_DECOMPRESSION_SIZE)
+
+#define PACK_FLAG_COMPRESSED 1      // Blob is DEFLATE compressed (CompressData())
+
+// Archive layout: header, index sorted by path, then blobs aligned to PACK_ALIGNMENT
+typedef struct PackHeader {
+    char magic[4];              // "DPAK"
+    unsigned int version;
+    unsigned int entryCount;
+    unsigned int reserved;
+} PackHeader;
+
+typedef struct PackEntry {
+    char path[PACK_PATH_SIZE];  // Asset path as requested by the game, i.e. "assets/audio/bark.mp3"
+    unsigned int offset;        // Blob offset from the start of the archive
+    unsigned int size;          // Blob size in the archive
+    unsigned int rawSize;       // Asset size, different from size if compressed
+    unsigned int flags;         // PACK_FLAG_*
+} PackEntry;
+
+// Map the archive and hook raylib file loading to it, assets not in the archive are read from disk
+bool MountPack(const char* fileName);
+// Unhook and unmap the archive, assets loaded from it must be unloaded before
+void UnmountPack(void);
+
+// Pack every file in a directory (recursively) into an archive
+bool BuildPack(const char* dirPath, const char* fileName, bool compress);
+
+#endif
@@ -1,4 +1,5 @@
 #include "player.h"
+#include "terrain.h"
 #include "raymath.h"
 #include "rlgl.h"
 #include "raymath.h"
@@ -6,6 +7,7 @@
 
 void InitDog(Dog* dog) {
     dog->position = (Vector3){ 0.0f, 0.5f, 0.0f }; // Start slightly above ground
+    dog->position.y = GetTerrainHeight(0.0f, 0.0f) + 0.5f;
     dog->speed = 8.0f;
     dog->verticalSpeed = 0.0f;
     dog->canJump = false;
@@ -71,11 +73,16 @@ void UpdateDog(Dog* dog, float deltaTime, float cameraAngle) {
     dog->position.y += dog->verticalSpeed * deltaTime;
     dog->verticalSpeed -= 30.0f * deltaTime; // Gravity constant
 
-    // Ground Collision (Ground is at Y = 0)
-    if (dog->position.y <= 0.5f) {
-        dog->position.y = 0.5f;
+    // Ground Collision (Terrain surface)
+    // When walking downhill, stay on the ground instead of falling in small hops
+    float groundY = GetTerrainHeight(dog->position.x, dog->position.z) + 0.5f;
+    bool onGround = dog->canJump && dog->verticalSpeed <= 0.0f && dog->position.y - groundY < 0.3f;
+    if (dog->position.y <= groundY || onGround) {
+        dog->position.y = groundY;
         dog->verticalSpeed = 0.0f;
         dog->canJump = true;
+    } else {
+        dog->canJump = false;
     }
 }
 
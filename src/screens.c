@@ -1,7 +1,6 @@
 #include "screens.h"
 #include "ui.h"
 #include "raymath.h"
-#include <stdio.h>
 #include <math.h>
 
 void UpdateTitleScreen(GameState* state, World* world, Dog* dog) {
@@ -9,10 +8,10 @@ void UpdateTitleScreen(GameState* state, World* world, Dog* dog) {
     
     // Rotate camera slowly for the menu background
     state->cameraAngleX += 0.002f;
-    state->camera.target = (Vector3){ 0.0f, 0.5f, 0.0f };
+    state->camera.target = (Vector3){ 0.0f, dog->position.y, 0.0f };
     state->camera.position.x = sinf(state->cameraAngleX) * state->cameraDist;
     state->camera.position.z = cosf(state->cameraAngleX) * state->cameraDist;
-    state->camera.position.y = 4.0f;
+    state->camera.position.y = dog->position.y + 3.5f;
 
     // --- Menu Logic ---
     int sw = GetScreenWidth();
@@ -56,7 +55,7 @@ void DrawTitleScreen(GameState* state, World* world, Dog* dog) {
     int sh = GetScreenHeight();
 
     // Draw 3D Background
-    DrawRectangle(0, 0, sw, sh, SKYBLUE); // Sky
+    DrawWorldSky(world);
     BeginMode3D(state->camera);
         DrawWorld3D(world);
         DrawDog3D(*dog);
@@ -66,17 +65,15 @@ void DrawTitleScreen(GameState* state, World* world, Dog* dog) {
     DrawRectangle(0, 0, sw, sh, (Color){0, 0, 0, 40}); // Slight tint
 
     // Draw the Game Title
-    const char* titleText = "DOOGO";
-    int titleWidth = MeasureText(titleText, 80);
+    const TextRun* titleText = GetTextRun("DOOGO", 80);
     
     // Shadow
-    DrawText(titleText, (sw - titleWidth) / 2 + 4, 84, 80, BLACK);
+    DrawTextRun(titleText, (sw - titleText->width) / 2 + 4, 84, BLACK);
     // Main Text
-    DrawText(titleText, (sw - titleWidth) / 2, 80, 80, GOLD);
+    DrawTextRun(titleText, (sw - titleText->width) / 2, 80, GOLD);
     
-    const char* subTitle = "The Good Boy Adventure";
-    int subWidth = MeasureText(subTitle, 30);
-    DrawText(subTitle, (sw - subWidth) / 2, 170, 30, RAYWHITE);
+    const TextRun* subTitle = GetTextRun("The Good Boy Adventure", 30);
+    DrawTextRun(subTitle, (sw - subTitle->width) / 2, 170, RAYWHITE);
 
     // Draw Buttons
     Rectangle btnStart = { sw/2 - 100, 250, 200, 40 };
@@ -111,8 +108,16 @@ void UpdateGameplayScreen(GameState* state, World* world, Dog* dog, float deltaT
     state->camera.position.x = state->camera.target.x + sinf(state->cameraAngleX) * state->cameraDist * cosf(state->cameraAngleY);
     state->camera.position.z = state->camera.target.z + cosf(state->cameraAngleX) * state->cameraDist * cosf(state->cameraAngleY);
     state->camera.position.y = state->camera.target.y + sinf(state->cameraAngleY) * state->cameraDist;
+
+    // Keep the camera above the hills
+    float groundY = GetTerrainHeight(state->camera.position.x, state->camera.position.z) + 0.5f;
+    if (state->camera.position.y < groundY) state->camera.position.y = groundY;
     // --------------------------
 
+    // Positional sounds are heard from the camera
+    Vector3 cameraForward = Vector3Subtract(state->camera.target, state->camera.position);
+    SetAudioListener(state->camera.position, cameraForward, state->camera.up);
+
     UpdateDog(dog, deltaTime, state->cameraAngleX);
     
     // Update World and check collisions
@@ -120,7 +125,7 @@ void UpdateGameplayScreen(GameState* state, World* world, Dog* dog, float deltaT
     UpdateWorld(world, &dog->position, &dog->score, &dog->health, dog->maxHealth);
 
     if (dog->score / 5 > previousScore / 5) {
-        PlaySound(barkSound);
+        PlaySoundAt(barkSound, dog->position);
     }
 
     // Check for Death
@@ -132,15 +137,18 @@ void UpdateGameplayScreen(GameState* state, World* world, Dog* dog, float deltaT
 }
 
 void DrawGameplayScreen(GameState* state, World* world, Dog* dog) {
+    DrawWorldSky(world);
     BeginMode3D(state->camera);
         DrawWorld3D(world);
         DrawDog3D(*dog);
     EndMode3D();
 
     // Draw Score
-    char scoreText[20];
-    sprintf(scoreText, "Bones: %d", dog->score);
-    DrawText(scoreText, 20, 20, 20, BLACK);
+    if ((state->scoreText.glyphCount == 0) || (state->scoreTextValue != dog->score)) {
+        SetTextRun(&state->scoreText, TextFormat("Bones: %d", dog->score), 20);
+        state->scoreTextValue = dog->score;
+    }
+    DrawTextRun(&state->scoreText, 20, 20, BLACK);
 
     // Draw Health Bar
     DrawHealthBar(dog->health, dog->maxHealth, 20, 50, 200, 20);
@@ -182,6 +190,7 @@ void DrawPauseScreen(GameState* state, World* world, Dog* dog) {
     int sh = GetScreenHeight();
 
     // Draw the game behind the menu (frozen)
+    DrawWorldSky(world);
     BeginMode3D(state->camera);
         DrawWorld3D(world);
         DrawDog3D(*dog);
@@ -191,9 +200,8 @@ void DrawPauseScreen(GameState* state, World* world, Dog* dog) {
     DrawRectangle(0, 0, sw, sh, (Color){ 0, 0, 0, 150 });
 
     // Pause Menu Text
-    const char* pauseText = "PAUSED";
-    int pauseWidth = MeasureText(pauseText, 40);
-    DrawText(pauseText, (sw - pauseWidth) / 2, 100, 40, WHITE);
+    const TextRun* pauseText = GetTextRun("PAUSED", 40);
+    DrawTextRun(pauseText, (sw - pauseText->width) / 2, 100, WHITE);
 
     Rectangle btnResume = { sw/2 - 100, 180, 200, 40 };
     Rectangle btnSettings = { sw/2 - 100, 230, 200, 40 };
@@ -237,7 +245,8 @@ void DrawSettingsScreen(GameState* state) {
     int sh = GetScreenHeight();
 
     DrawRectangle(0, 0, sw, sh, (Color){ 20, 20, 20, 255 }); // Dark background
-    DrawText("SETTINGS", (sw - MeasureText("SETTINGS", 40))/2, 100, 40, WHITE);
+    const TextRun* settingsText = GetTextRun("SETTINGS", 40);
+    DrawTextRun(settingsText, (sw - settingsText->width)/2, 100, WHITE);
 
     Rectangle btnFull = { sw/2 - 120, 200, 240, 40 };
     Rectangle btnBack = { sw/2 - 120, 260, 240, 40 };
@@ -280,9 +289,8 @@ void DrawEndingScreen(GameState* state) {
 
     DrawRectangle(0, 0, sw, sh, (Color){ 0, 0, 0, 200 }); // Dark overlay
     
-    const char* text = "YOU DIED";
-    int textW = MeasureText(text, 60);
-    DrawText(text, (sw - textW)/2, 100, 60, RED);
+    const TextRun* text = GetTextRun("YOU DIED", 60);
+    DrawTextRun(text, (sw - text->width)/2, 100, RED);
 
     Rectangle btnRespawn = { sw/2 - 100, 250, 200, 40 };
     Rectangle btnMenu = { sw/2 - 100, 300, 200, 40 };
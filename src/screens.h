@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "player.h"
 #include "world.h"
+#include "ui.h"
 
 typedef enum GameScreen {
     SCREEN_TITLE = 0,
@@ -22,6 +23,9 @@ typedef struct GameState {
     float cameraAngleY;
     float cameraDist;
     int framesCounter;
+    TextRun scoreText;      // HUD score, laid out again only when the score changes
+    int scoreTextValue;
+    bool showMemoryOverlay; // F3 on debug builds, memory usage by subsystem (see DrawMemoryOverlay())
     bool shouldQuit;
 } GameState;
 
@@ -0,0 +1,327 @@
+#include "terrain.h"
+#include "raymath.h"
+#include "texgen.h"
+#include "external/stb_perlin.h" // Implementation is compiled into raylib (rtextures)
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TERRAIN_HEIGHT 4.0f         // Max height of the hills above/below y = 0
+#define TERRAIN_NOISE_SCALE 0.015f  // Noise frequency (lower = wider hills)
+#define TERRAIN_UPLOADS_PER_FRAME 4 // Max chunk meshes uploaded to the GPU every frame
+#define TERRAIN_TEXTURE_SIZE 8.0f   // World units covered by one repeat of the ground texture
+
+static const float quadSize = TERRAIN_CHUNK_SIZE / TERRAIN_CHUNK_QUADS;
+
+// Integer division/modulo rounding towards negative infinity (chunks exist at negative coordinates too)
+static int FloorDiv(int a, int b) {
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+static int FloorMod(int a, int b) {
+    return a - FloorDiv(a, b) * b;
+}
+
+static float GetTerrainNoise(int gx, int gz) {
+    float x = gx * quadSize;
+    float z = gz * quadSize;
+    return stb_perlin_fbm_noise3(x * TERRAIN_NOISE_SCALE, 0.37f, z * TERRAIN_NOISE_SCALE, 2.0f, 0.5f, 4) * TERRAIN_HEIGHT;
+}
+
+// Height of a vertex of the finest LOD grid
+// Vertices on chunk edges are interpolated from the coarsest LOD samples, so every LOD
+// produces the same edge line and neighbour chunks with different LOD don't leave cracks
+static float GetTerrainGridHeight(int gx, int gz) {
+    int coarseStep = 1 << (TERRAIN_LOD_COUNT - 1);
+    bool edgeX = FloorMod(gx, TERRAIN_CHUNK_QUADS) == 0;
+    bool edgeZ = FloorMod(gz, TERRAIN_CHUNK_QUADS) == 0;
+
+    if (edgeX && !edgeZ) {
+        int gz0 = FloorDiv(gz, coarseStep) * coarseStep;
+        float t = (float)(gz - gz0) / coarseStep;
+        return Lerp(GetTerrainNoise(gx, gz0), GetTerrainNoise(gx, gz0 + coarseStep), t);
+    }
+    if (edgeZ && !edgeX) {
+        int gx0 = FloorDiv(gx, coarseStep) * coarseStep;
+        float t = (float)(gx - gx0) / coarseStep;
+        return Lerp(GetTerrainNoise(gx0, gz), GetTerrainNoise(gx0 + coarseStep, gz), t);
+    }
+
+    return GetTerrainNoise(gx, gz);
+}
+
+float GetTerrainHeight(float x, float z) {
+    float fx = x / quadSize;
+    float fz = z / quadSize;
+    int gx = (int)floorf(fx);
+    int gz = (int)floorf(fz);
+    fx -= gx;
+    fz -= gz;
+
+    float h00 = GetTerrainGridHeight(gx, gz);
+    float h11 = GetTerrainGridHeight(gx + 1, gz + 1);
+
+    // Same triangle split as the chunk meshes (diagonal from h00 to h11)
+    if (fx >= fz) {
+        float h10 = GetTerrainGridHeight(gx + 1, gz);
+        return h00 + fx * (h10 - h00) + fz * (h11 - h10);
+    } else {
+        float h01 = GetTerrainGridHeight(gx, gz + 1);
+        return h00 + fz * (h01 - h00) + fx * (h11 - h01);
+    }
+}
+
+// Build chunk mesh data (CPU only, safe to call from the worker thread)
+static Mesh GenTerrainChunkMesh(int cx, int cz, int lod) {
+    int res = TERRAIN_CHUNK_QUADS >> lod;
+    int step = 1 << lod;
+    int side = res + 1;
+    int gx0 = cx * TERRAIN_CHUNK_QUADS;
+    int gz0 = cz * TERRAIN_CHUNK_QUADS;
+
+    Mesh mesh = { 0 };
+    mesh.vertexCount = side * side;
+    mesh.triangleCount = res * res * 2;
+    mesh.vertices = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.normals = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+    mesh.colors = (unsigned char*)MemAlloc(mesh.vertexCount * 4);
+    mesh.indices = (unsigned short*)MemAlloc(mesh.triangleCount * 3 * sizeof(unsigned short));
+
+    // Heights with a 1 vertex border, so normals of edge vertices use the neighbour chunk
+    int border = side + 2;
+    float* heights = (float*)MemAlloc(border * border * sizeof(float));
+    for (int z = 0; z < border; z++) {
+        for (int x = 0; x < border; x++) {
+            heights[z * border + x] = GetTerrainGridHeight(gx0 + (x - 1) * step, gz0 + (z - 1) * step);
+        }
+    }
+
+    Vector3 lightDir = Vector3Normalize((Vector3){ 0.4f, 1.0f, 0.3f });
+
+    for (int z = 0; z < side; z++) {
+        for (int x = 0; x < side; x++) {
+            int v = z * side + x;
+            float h = heights[(z + 1) * border + x + 1];
+            float hl = heights[(z + 1) * border + x];
+            float hr = heights[(z + 1) * border + x + 2];
+            float hd = heights[z * border + x + 1];
+            float hu = heights[(z + 2) * border + x + 1];
+
+            mesh.vertices[v * 3 + 0] = (gx0 + x * step) * quadSize;
+            mesh.vertices[v * 3 + 1] = h;
+            mesh.vertices[v * 3 + 2] = (gz0 + z * step) * quadSize;
+
+            Vector3 n = Vector3Normalize((Vector3){ hl - hr, 2.0f * step * quadSize, hd - hu });
+            mesh.normals[v * 3 + 0] = n.x;
+            mesh.normals[v * 3 + 1] = n.y;
+            mesh.normals[v * 3 + 2] = n.z;
+
+            // World space texcoords, the ground texture repeats seamlessly across chunks
+            mesh.texcoords[v * 2 + 0] = mesh.vertices[v * 3 + 0] / TERRAIN_TEXTURE_SIZE;
+            mesh.texcoords[v * 2 + 1] = mesh.vertices[v * 3 + 2] / TERRAIN_TEXTURE_SIZE;
+
+            // Baked lighting, the default shader doesn't shade by normals
+            float shade = 0.55f + 0.45f * fmaxf(Vector3DotProduct(n, lightDir), 0.0f);
+            float tint = 1.0f + 0.05f * h;
+            mesh.colors[v * 4 + 0] = (unsigned char)Clamp(50.0f * shade * tint, 0, 255);
+            mesh.colors[v * 4 + 1] = (unsigned char)Clamp(160.0f * shade * tint, 0, 255);
+            mesh.colors[v * 4 + 2] = (unsigned char)Clamp(50.0f * shade, 0, 255);
+            mesh.colors[v * 4 + 3] = 255;
+        }
+    }
+
+    MemFree(heights);
+
+    // Triangles split along the (x, z) -> (x + 1, z + 1) diagonal, see GetTerrainHeight()
+    int i = 0;
+    for (int z = 0; z < res; z++) {
+        for (int x = 0; x < res; x++) {
+            unsigned short v00 = (unsigned short)(z * side + x);
+            unsigned short v10 = v00 + 1;
+            unsigned short v01 = v00 + side;
+            unsigned short v11 = v01 + 1;
+
+            mesh.indices[i++] = v00;
+            mesh.indices[i++] = v11;
+            mesh.indices[i++] = v10;
+
+            mesh.indices[i++] = v00;
+            mesh.indices[i++] = v01;
+            mesh.indices[i++] = v11;
+        }
+    }
+
+    return mesh;
+}
+
+static bool PushTerrainJob(TerrainQueue* queue, TerrainJob job) {
+    if (queue->count >= TERRAIN_MAX_JOBS) return false;
+    queue->jobs[(queue->head + queue->count) % TERRAIN_MAX_JOBS] = job;
+    queue->count++;
+    return true;
+}
+
+static bool PopTerrainJob(TerrainQueue* queue, TerrainJob* job) {
+    if (queue->count == 0) return false;
+    *job = queue->jobs[queue->head];
+    queue->head = (queue->head + 1) % TERRAIN_MAX_JOBS;
+    queue->count--;
+    return true;
+}
+
+static void* TerrainWorker(void* arg) {
+    Terrain* terrain = (Terrain*)arg;
+
+    pthread_mutex_lock(&terrain->mutex);
+    while (true) {
+        TerrainJob job;
+        while (!terrain->quit && !PopTerrainJob(&terrain->requests, &job)) {
+            pthread_cond_wait(&terrain->jobReady, &terrain->mutex);
+        }
+        if (terrain->quit) break;
+
+        pthread_mutex_unlock(&terrain->mutex);
+        job.mesh = GenTerrainChunkMesh(job.cx, job.cz, job.lod);
+        pthread_mutex_lock(&terrain->mutex);
+
+        // Results queue holds at most one result per request, it can't be full here
+        PushTerrainJob(&terrain->results, job);
+    }
+    pthread_mutex_unlock(&terrain->mutex);
+
+    return NULL;
+}
+
+// LOD by chunk distance to the player chunk: finest around the player, coarsest at the edges
+static int GetChunkLod(int dx, int dz) {
+    int dist = (abs(dx) > abs(dz)) ? abs(dx) : abs(dz);
+    if (dist <= 1) return 0;
+    if (dist <= 2) return 1;
+    return TERRAIN_LOD_COUNT - 1;
+}
+
+static int GetChunkSlot(int cx, int cz) {
+    return FloorMod(cz, TERRAIN_GRID) * TERRAIN_GRID + FloorMod(cx, TERRAIN_GRID);
+}
+
+static void SetChunkMesh(TerrainChunk* chunk, TerrainJob* job) {
+    if (chunk->lod >= 0) UnloadMesh(chunk->mesh);
+    UploadMesh(&job->mesh, false);
+    chunk->mesh = job->mesh;
+    chunk->cx = job->cx;
+    chunk->cz = job->cz;
+    chunk->lod = job->lod;
+}
+
+static void SetWantedChunks(Terrain* terrain, Vector3 center) {
+    int pcx = (int)floorf(center.x / TERRAIN_CHUNK_SIZE);
+    int pcz = (int)floorf(center.z / TERRAIN_CHUNK_SIZE);
+
+    for (int dz = -TERRAIN_VIEW_CHUNKS; dz <= TERRAIN_VIEW_CHUNKS; dz++) {
+        for (int dx = -TERRAIN_VIEW_CHUNKS; dx <= TERRAIN_VIEW_CHUNKS; dx++) {
+            TerrainChunk* chunk = &terrain->chunks[GetChunkSlot(pcx + dx, pcz + dz)];
+            chunk->wantedCx = pcx + dx;
+            chunk->wantedCz = pcz + dz;
+            chunk->wantedLod = GetChunkLod(dx, dz);
+        }
+    }
+}
+
+void InitTerrain(Terrain* terrain) {
+    if (terrain->ready) return;
+
+    memset(terrain, 0, sizeof(Terrain));
+    terrain->material = LoadMaterialDefault();
+
+    // Neutral ground detail, modulated by the baked vertex colors
+    TexGenParams ground = { TEXGEN_GROUND, 512, 7, 24.0f, 64, (Color){ 175, 175, 160, 255 }, WHITE };
+    terrain->material.maps[MATERIAL_MAP_DIFFUSE].texture = LoadProceduralTexture(ground);
+
+    // First chunks are built right away so the ground is there on the first frame
+    SetWantedChunks(terrain, (Vector3){ 0 });
+    for (int i = 0; i < TERRAIN_MAX_CHUNKS; i++) {
+        TerrainChunk* chunk = &terrain->chunks[i];
+        TerrainJob job = { i, chunk->wantedCx, chunk->wantedCz, chunk->wantedLod };
+        job.mesh = GenTerrainChunkMesh(job.cx, job.cz, job.lod);
+        chunk->lod = -1;
+        SetChunkMesh(chunk, &job);
+        chunk->requestedCx = job.cx;
+        chunk->requestedCz = job.cz;
+        chunk->requestedLod = job.lod;
+    }
+
+    pthread_mutex_init(&terrain->mutex, NULL);
+    pthread_cond_init(&terrain->jobReady, NULL);
+    pthread_create(&terrain->thread, NULL, TerrainWorker, terrain);
+
+    terrain->ready = true;
+}
+
+void UpdateTerrain(Terrain* terrain, Vector3 center) {
+    if (!terrain->ready) return;
+
+    SetWantedChunks(terrain, center);
+
+    pthread_mutex_lock(&terrain->mutex);
+
+    // Request meshes for chunks that changed position or LOD
+    bool requested = false;
+    for (int i = 0; i < TERRAIN_MAX_CHUNKS; i++) {
+        TerrainChunk* chunk = &terrain->chunks[i];
+        if (chunk->requestedCx == chunk->wantedCx && chunk->requestedCz == chunk->wantedCz && chunk->requestedLod == chunk->wantedLod) continue;
+
+        // Keep room in the results queue for every request that could be in flight
+        if (terrain->requests.count + terrain->results.count + 1 >= TERRAIN_MAX_JOBS) break;
+
+        TerrainJob job = { i, chunk->wantedCx, chunk->wantedCz, chunk->wantedLod };
+        PushTerrainJob(&terrain->requests, job);
+        chunk->requestedCx = job.cx;
+        chunk->requestedCz = job.cz;
+        chunk->requestedLod = job.lod;
+        requested = true;
+    }
+    if (requested) pthread_cond_signal(&terrain->jobReady);
+
+    // Upload finished meshes, results that are not wanted anymore are discarded
+    TerrainJob results[TERRAIN_UPLOADS_PER_FRAME];
+    int resultCount = 0;
+    while (resultCount < TERRAIN_UPLOADS_PER_FRAME && PopTerrainJob(&terrain->results, &results[resultCount])) resultCount++;
+
+    pthread_mutex_unlock(&terrain->mutex);
+
+    for (int i = 0; i < resultCount; i++) {
+        TerrainJob* job = &results[i];
+        TerrainChunk* chunk = &terrain->chunks[job->slot];
+        if (job->cx == chunk->wantedCx && job->cz == chunk->wantedCz && job->lod == chunk->wantedLod) SetChunkMesh(chunk, job);
+        else UnloadMesh(job->mesh);
+    }
+}
+
+void DrawTerrain(Terrain* terrain) {
+    for (int i = 0; i < TERRAIN_MAX_CHUNKS; i++) {
+        if (terrain->chunks[i].lod >= 0) DrawMesh(terrain->chunks[i].mesh, terrain->material, MatrixIdentity());
+    }
+}
+
+void UnloadTerrain(Terrain* terrain) {
+    if (!terrain->ready) return;
+
+    pthread_mutex_lock(&terrain->mutex);
+    terrain->quit = true;
+    pthread_cond_signal(&terrain->jobReady);
+    pthread_mutex_unlock(&terrain->mutex);
+    pthread_join(terrain->thread, NULL);
+
+    TerrainJob job;
+    while (PopTerrainJob(&terrain->results, &job)) UnloadMesh(job.mesh);
+
+    for (int i = 0; i < TERRAIN_MAX_CHUNKS; i++) {
+        if (terrain->chunks[i].lod >= 0) UnloadMesh(terrain->chunks[i].mesh);
+    }
+
+    UnloadMaterial(terrain->material);
+    pthread_mutex_destroy(&terrain->mutex);
+    pthread_cond_destroy(&terrain->jobReady);
+    terrain->ready = false;
+}
@@ -0,0 +1,61 @@
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+#include "raylib.h"
+#include <pthread.h>
+
+#define TERRAIN_CHUNK_SIZE 64.0f    // World units per chunk side
+#define TERRAIN_CHUNK_QUADS 64      // Quads per chunk side at the finest LOD (1 world unit per quad)
+#define TERRAIN_LOD_COUNT 3         // Each LOD halves the resolution of the previous one
+#define TERRAIN_VIEW_CHUNKS 4       // Chunks loaded around the player in each direction
+#define TERRAIN_GRID (2*TERRAIN_VIEW_CHUNKS + 1)
+#define TERRAIN_MAX_CHUNKS (TERRAIN_GRID*TERRAIN_GRID)
+#define TERRAIN_MAX_JOBS (2*TERRAIN_MAX_CHUNKS)
+
+typedef struct TerrainChunk {
+    int cx, cz;             // Chunk coordinates of the uploaded mesh
+    int lod;                // LOD of the uploaded mesh (-1 if none)
+    int wantedCx, wantedCz; // Chunk coordinates this slot should show
+    int wantedLod;
+    int requestedCx, requestedCz; // Last mesh requested to the worker thread
+    int requestedLod;
+    Mesh mesh;
+} TerrainChunk;
+
+// Chunk mesh build request/result exchanged with the worker thread
+typedef struct TerrainJob {
+    int slot;
+    int cx, cz;
+    int lod;
+    Mesh mesh;
+} TerrainJob;
+
+typedef struct TerrainQueue {
+    TerrainJob jobs[TERRAIN_MAX_JOBS];
+    int head;
+    int count;
+} TerrainQueue;
+
+typedef struct Terrain {
+    TerrainChunk chunks[TERRAIN_MAX_CHUNKS];
+    Material material;
+    bool ready;
+
+    // Meshing happens on a worker thread, GPU uploads on the main thread
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t jobReady;
+    TerrainQueue requests;
+    TerrainQueue results;
+    bool quit;
+} Terrain;
+
+void InitTerrain(Terrain* terrain);
+void UpdateTerrain(Terrain* terrain, Vector3 center);
+void DrawTerrain(Terrain* terrain);
+void UnloadTerrain(Terrain* terrain);
+
+// Height of the terrain surface at a world position, matches the finest LOD mesh
+float GetTerrainHeight(float x, float z);
+
+#endif
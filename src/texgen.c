@@ -0,0 +1,288 @@
+#include "texgen.h"
+#include "raymath.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef enum TexGenPhase {
+    TEXGEN_PHASE_NOISE = 0, // Fill the noise buffer with GenImagePerlinNoise() tiles
+    TEXGEN_PHASE_COMPOSE    // Build the texture pixels from the noise buffer
+} TexGenPhase;
+
+// Generation shared by the threads, they pick tiles until none are left
+typedef struct TexGenJob {
+    TexGenParams params;
+    int fieldWidth, fieldHeight;    // Tileable noise field size, the noise buffer is twice as big on each side
+    unsigned char* noise;
+    Color* pixels;
+    TexGenPhase phase;
+    int tilesX, tilesY;
+    int nextTile;
+    pthread_mutex_t mutex;
+} TexGenJob;
+
+static const char* texGenNames[] = { "ground", "bark", "sky" };
+
+static unsigned int HashTexGenValue(unsigned int hash, unsigned int value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= 16777619u; // FNV-1a
+    }
+    return hash;
+}
+
+// Fields are hashed one by one, struct padding is not part of the key
+static unsigned int HashTexGenParams(TexGenParams params) {
+    unsigned int noiseScale = 0;
+    memcpy(&noiseScale, &params.noiseScale, sizeof(float));
+
+    unsigned int hash = 2166136261u;
+    hash = HashTexGenValue(hash, TEXGEN_VERSION);
+    hash = HashTexGenValue(hash, (unsigned int)params.type);
+    hash = HashTexGenValue(hash, (unsigned int)params.size);
+    hash = HashTexGenValue(hash, (unsigned int)params.seed);
+    hash = HashTexGenValue(hash, noiseScale);
+    hash = HashTexGenValue(hash, (unsigned int)params.cellSize);
+    hash = HashTexGenValue(hash, (unsigned int)ColorToInt(params.colorA));
+    hash = HashTexGenValue(hash, (unsigned int)ColorToInt(params.colorB));
+    return hash;
+}
+
+static void GenNoiseTile(TexGenJob* job, int tx, int ty) {
+    int bufferWidth = job->fieldWidth * 2;
+
+    // Tile scale keeps the frequency of the whole field, GenImagePerlinNoise() scales by image width
+    float scale = job->params.noiseScale * TEXGEN_TILE_SIZE / job->fieldWidth;
+    int seedOffset = (job->params.seed % 32) * bufferWidth; // Seed picks a region of the noise
+
+    Image tile = GenImagePerlinNoise(TEXGEN_TILE_SIZE, TEXGEN_TILE_SIZE, seedOffset + tx * TEXGEN_TILE_SIZE, ty * TEXGEN_TILE_SIZE, scale);
+    const Color* tilePixels = (const Color*)tile.data;
+
+    for (int y = 0; y < TEXGEN_TILE_SIZE; y++) {
+        unsigned char* row = job->noise + (ty * TEXGEN_TILE_SIZE + y) * bufferWidth + tx * TEXGEN_TILE_SIZE;
+        for (int x = 0; x < TEXGEN_TILE_SIZE; x++) row[x] = tilePixels[y * TEXGEN_TILE_SIZE + x].r;
+    }
+
+    UnloadImage(tile);
+}
+
+// Noise in [0..1] tiling with period (fieldWidth, fieldHeight): four quadrants of the buffer are blended
+// so opposite edges sample the same values, normalized by the weights so contrast is kept in the middle
+static float GetTileableNoise(const TexGenJob* job, int x, int y) {
+    int w = job->fieldWidth;
+    int h = job->fieldHeight;
+    const unsigned char* noise = job->noise;
+    int stride = 2 * w;
+
+    float fx = (float)x / w;
+    float fy = (float)y / h;
+    float w0 = (1.0f - fx) * (1.0f - fy);
+    float w1 = fx * (1.0f - fy);
+    float w2 = (1.0f - fx) * fy;
+    float w3 = fx * fy;
+
+    float n0 = noise[(y + h) * stride + x + w] / 255.0f - 0.5f;
+    float n1 = noise[(y + h) * stride + x] / 255.0f - 0.5f;
+    float n2 = noise[y * stride + x + w] / 255.0f - 0.5f;
+    float n3 = noise[y * stride + x] / 255.0f - 0.5f;
+
+    float n = (w0 * n0 + w1 * n1 + w2 * n2 + w3 * n3) / sqrtf(w0 * w0 + w1 * w1 + w2 * w2 + w3 * w3);
+    return Clamp(n + 0.5f, 0.0f, 1.0f);
+}
+
+static unsigned int HashCell(int x, int y, int seed) {
+    unsigned int h = (unsigned int)x * 73856093u ^ (unsigned int)y * 19349663u ^ (unsigned int)seed * 83492791u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// Distance to the nearest cell point in cell units, like GenImageCellular() but with hashed points
+// (reproducible and thread safe, GetRandomValue() isn't) and cells wrapping around, so it tiles
+static float GetTileableCellular(int x, int y, int size, int cellSize, int seed) {
+    int cells = size / cellSize;
+    int cx = x / cellSize;
+    int cy = y / cellSize;
+    float minDist = 2.0f;
+
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            int nx = cx + dx;
+            int ny = cy + dy;
+            unsigned int h = HashCell((nx + cells) % cells, (ny + cells) % cells, seed);
+
+            float px = (nx + (h & 0xffff) / 65535.0f) * cellSize;
+            float py = (ny + (h >> 16) / 65535.0f) * cellSize;
+            float dist = sqrtf((x + 0.5f - px) * (x + 0.5f - px) + (y + 0.5f - py) * (y + 0.5f - py)) / cellSize;
+            if (dist < minDist) minDist = dist;
+        }
+    }
+
+    return minDist;
+}
+
+static Color GetTexGenPixel(const TexGenJob* job, int x, int y) {
+    const TexGenParams* params = &job->params;
+
+    switch (params->type) {
+        case TEXGEN_GROUND: {
+            float n = GetTileableNoise(job, x, y);
+            float patch = 1.0f - Clamp(GetTileableCellular(x, y, params->size, params->cellSize, params->seed) / 0.5f, 0.0f, 1.0f);
+            return ColorLerp(params->colorA, params->colorB, n * (1.0f - 0.6f * patch * patch));
+        }
+        case TEXGEN_BARK: {
+            // Noise rows are interpolated to stretch it, the field height is size/TEXGEN_BARK_STRETCH
+            float fy = (float)y / TEXGEN_BARK_STRETCH;
+            int y0 = (int)fy;
+            int y1 = (y0 + 1) % job->fieldHeight;
+            float n = Lerp(GetTileableNoise(job, x, y0), GetTileableNoise(job, x, y1), fy - y0);
+            float ridge = 1.0f - fabsf(2.0f * n - 1.0f);
+            return ColorLerp(params->colorA, params->colorB, ridge * ridge);
+        }
+        case TEXGEN_SKY: {
+            float t = (float)y / (params->size - 1);
+            float cloud = Clamp((GetTileableNoise(job, x, y) - 0.55f) * 3.0f, 0.0f, 1.0f) * (1.0f - 0.5f * t);
+            return ColorLerp(ColorLerp(params->colorA, params->colorB, t), WHITE, 0.85f * cloud);
+        }
+        default: return MAGENTA;
+    }
+}
+
+static void ComposeTile(TexGenJob* job, int tx, int ty) {
+    int size = job->params.size;
+
+    for (int y = ty * TEXGEN_TILE_SIZE; y < (ty + 1) * TEXGEN_TILE_SIZE; y++) {
+        for (int x = tx * TEXGEN_TILE_SIZE; x < (tx + 1) * TEXGEN_TILE_SIZE; x++) {
+            Color color = GetTexGenPixel(job, x, y);
+            color.a = 255; // ColorLerp() can round opaque alpha down to 254
+            job->pixels[y * size + x] = color;
+        }
+    }
+}
+
+static void* TexGenWorker(void* arg) {
+    TexGenJob* job = (TexGenJob*)arg;
+
+    while (true) {
+        pthread_mutex_lock(&job->mutex);
+        int tile = job->nextTile++;
+        pthread_mutex_unlock(&job->mutex);
+        if (tile >= job->tilesX * job->tilesY) break;
+
+        if (job->phase == TEXGEN_PHASE_NOISE) GenNoiseTile(job, tile % job->tilesX, tile / job->tilesX);
+        else ComposeTile(job, tile % job->tilesX, tile / job->tilesX);
+    }
+
+    return NULL;
+}
+
+static void RunTexGenPhase(TexGenJob* job, TexGenPhase phase, int tilesX, int tilesY) {
+    job->phase = phase;
+    job->tilesX = tilesX;
+    job->tilesY = tilesY;
+    job->nextTile = 0;
+
+    pthread_t threads[TEXGEN_THREADS - 1];
+    int threadCount = 0;
+    while (threadCount < TEXGEN_THREADS - 1 && pthread_create(&threads[threadCount], NULL, TexGenWorker, job) == 0) threadCount++;
+
+    TexGenWorker(job); // Calling thread takes tiles too, and does all the work if threads couldn't be created
+    for (int i = 0; i < threadCount; i++) pthread_join(threads[i], NULL);
+}
+
+Image GenProceduralImage(TexGenParams params) {
+    if ((params.size < 256) || ((params.size & (params.size - 1)) != 0)) {
+        TraceLog(LOG_WARNING, "TEXGEN: Texture size %i not supported, using 256", params.size);
+        params.size = 256;
+    }
+    if ((params.cellSize <= 0) || (params.size % params.cellSize != 0)) params.cellSize = params.size / 8;
+
+    TexGenJob job = { 0 };
+    job.params = params;
+    job.fieldWidth = params.size;
+    job.fieldHeight = (params.type == TEXGEN_BARK) ? params.size / TEXGEN_BARK_STRETCH : params.size;
+    job.noise = (unsigned char*)MemAlloc(4 * job.fieldWidth * job.fieldHeight);
+    job.pixels = (Color*)MemAlloc(params.size * params.size * sizeof(Color));
+    pthread_mutex_init(&job.mutex, NULL);
+
+    RunTexGenPhase(&job, TEXGEN_PHASE_NOISE, 2 * job.fieldWidth / TEXGEN_TILE_SIZE, 2 * job.fieldHeight / TEXGEN_TILE_SIZE);
+    RunTexGenPhase(&job, TEXGEN_PHASE_COMPOSE, params.size / TEXGEN_TILE_SIZE, params.size / TEXGEN_TILE_SIZE);
+
+    pthread_mutex_destroy(&job.mutex);
+    MemFree(job.noise);
+
+    Image image = { job.pixels, params.size, params.size, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    return image;
+}
+
+static void GetTexGenFileName(TexGenParams params, const char* extension, char* fileName) {
+    snprintf(fileName, TEXGEN_FILE_NAME_SIZE, "%s/%s_%08x.%s", TEXGEN_CACHE_DIR, texGenNames[params.type], HashTexGenParams(params), extension);
+}
+
+static Image GenProceduralImageLogged(TexGenParams params, const char* fileName) {
+    double startTime = GetTime();
+    Image image = GenProceduralImage(params);
+    TraceLog(LOG_INFO, "TEXGEN: [%s] Generated in %.1f ms", fileName, (GetTime() - startTime) * 1000.0);
+    return image;
+}
+
+static void ExportTexGenCache(Image image, const char* fileName) {
+    if (!DirectoryExists(TEXGEN_CACHE_DIR)) MakeDirectory(TEXGEN_CACHE_DIR);
+    if (!ExportImage(image, fileName)) TraceLog(LOG_WARNING, "TEXGEN: [%s] Failed to cache texture", fileName);
+}
+
+Image LoadProceduralImage(TexGenParams params) {
+    char fileName[TEXGEN_FILE_NAME_SIZE];
+    GetTexGenFileName(params, "qoi", fileName);
+
+    Image image = { 0 };
+    if (FileExists(fileName)) image = LoadImage(fileName);
+    if (IsImageValid(image) && (image.width == params.size) && (image.height == params.size)) return image;
+
+    UnloadImage(image);
+    image = GenProceduralImageLogged(params, fileName);
+    ExportTexGenCache(image, fileName);
+
+    return image;
+}
+
+Texture2D LoadProceduralTexture(TexGenParams params) {
+    char fileName[TEXGEN_FILE_NAME_SIZE];
+    GetTexGenFileName(params, "dds", fileName);
+
+    Image image = { 0 };
+    if (FileExists(fileName)) image = LoadImage(fileName);
+
+    if (!IsImageValid(image) || (image.width != params.size) || (image.height != params.size) || (image.format != TEXGEN_TEXTURE_FORMAT)) {
+        UnloadImage(image);
+        image = GenProceduralImageLogged(params, fileName);
+
+        // Cached ready for the GPU, compressed with the whole mipmaps chain (colors averaged in linear space)
+        double startTime = GetTime();
+        ImageMipmapsEx(&image, true);
+        ImageCompress(&image, TEXGEN_TEXTURE_FORMAT, 2);
+        TraceLog(LOG_INFO, "TEXGEN: [%s] Compressed in %.1f ms", fileName, (GetTime() - startTime) * 1000.0);
+
+        ExportTexGenCache(image, fileName);
+    }
+
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    // GPU without DXT support, uploaded uncompressed
+    if (texture.id == 0) {
+        image = GenProceduralImage(params);
+        ImageMipmapsEx(&image, true);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+    SetTextureWrap(texture, (params.type == TEXGEN_SKY) ? TEXTURE_WRAP_CLAMP : TEXTURE_WRAP_REPEAT);
+
+    return texture;
+}
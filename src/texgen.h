@@ -0,0 +1,38 @@
+#ifndef TEXGEN_H
+#define TEXGEN_H
+
+#include "raylib.h"
+
+#define TEXGEN_CACHE_DIR "cache"    // Generated textures are cached here, named by a hash of their parameters
+#define TEXGEN_VERSION 3            // Bump when generators change, so stale cached textures are regenerated
+#define TEXGEN_TEXTURE_FORMAT PIXELFORMAT_COMPRESSED_DXT1_RGB   // Cached textures format (.dds), 1/8 of RGBA8 in VRAM
+#define TEXGEN_FILE_NAME_SIZE 256
+#define TEXGEN_TILE_SIZE 64         // Textures are generated in square tiles, spread over TEXGEN_THREADS
+#define TEXGEN_THREADS 4            // Generator threads (including the calling thread)
+#define TEXGEN_BARK_STRETCH 4       // Bark noise is stretched vertically into streaks
+
+typedef enum TexGenType {
+    TEXGEN_GROUND = 0,  // Noise with cellular dirt patches, tileable
+    TEXGEN_BARK,        // Vertical ridged streaks, tileable
+    TEXGEN_SKY          // Vertical gradient with noise clouds
+} TexGenType;
+
+// Generator parameters, the cached texture is reused while they don't change
+typedef struct TexGenParams {
+    TexGenType type;
+    int size;           // Width and height, power of two (256 minimum)
+    int seed;
+    float noiseScale;   // Perlin noise frequency across the texture
+    int cellSize;       // Cellular noise cell size in pixels, must divide size (ground only)
+    Color colorA;       // Dark color (sky: top color)
+    Color colorB;       // Light color (sky: horizon color)
+} TexGenParams;
+
+// Load a procedural texture from the disk cache (compressed, mipmapped), generated and cached if missing. Trilinear filtering
+Texture2D LoadProceduralTexture(TexGenParams params);
+// Load a procedural texture image from the disk cache, generated and cached if missing (i.e. to pack it in an atlas)
+Image LoadProceduralImage(TexGenParams params);
+// Generate a procedural texture image (CPU only, no cache)
+Image GenProceduralImage(TexGenParams params);
+
+#endif
@@ -1,4 +1,114 @@
 #include "ui.h"
+#include "rlgl.h"
+#include <string.h>
+
+#define TEXT_RUN_CACHE_SIZE 32      // Constant UI strings kept laid out, oldest replaced first
+#define MEMORY_RATE_INTERVAL 0.5    // Seconds between memory overlay allocation rate samples
+
+static TextRun textRunCache[TEXT_RUN_CACHE_SIZE] = { 0 };
+static int textRunCacheNext = 0;
+
+// Runs only keep the first TEXT_RUN_MAX_LENGTH - 1 bytes, longer strings sharing them are laid out the same
+static bool IsTextRunOf(const TextRun* run, const char* text, int fontSize) {
+    return (run->fontSize == fontSize) && (strncmp(run->text, text, TEXT_RUN_MAX_LENGTH - 1) == 0);
+}
+
+void SetTextRun(TextRun* run, const char* text, int fontSize) {
+    if (fontSize < 10) fontSize = 10; // Same minimum size as DrawText()
+    if (IsTextRunOf(run, text, fontSize)) return;
+
+    strncpy(run->text, text, TEXT_RUN_MAX_LENGTH - 1);
+    run->text[TEXT_RUN_MAX_LENGTH - 1] = '\0';
+    run->fontSize = fontSize;
+    run->glyphCount = 0;
+
+    // Same layout as DrawText(): default font, spacing of fontSize/10
+    Font font = GetFontDefault();
+    float scale = (float)fontSize / font.baseSize;
+    float spacing = (float)(fontSize / 10);
+    float padding = (float)font.glyphPadding;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    for (int i = 0; run->text[i] != '\0';) {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&run->text[i], &codepointSize);
+        i += codepointSize;
+
+        if (codepoint == '\n') {
+            offsetY += (float)(fontSize + 2); // Default text line spacing
+            offsetX = 0.0f;
+            continue;
+        }
+
+        int index = GetGlyphIndex(font, codepoint);
+        Rectangle rec = font.recs[index];
+
+        if ((codepoint != ' ') && (codepoint != '\t')) {
+            run->quads[run->glyphCount] = (Rectangle){ offsetX + (font.glyphs[index].offsetX - padding) * scale,
+                                                       offsetY + (font.glyphs[index].offsetY - padding) * scale,
+                                                       (rec.width + 2.0f * padding) * scale,
+                                                       (rec.height + 2.0f * padding) * scale };
+            run->uvs[run->glyphCount] = (Rectangle){ (rec.x - padding) / font.texture.width,
+                                                     (rec.y - padding) / font.texture.height,
+                                                     (rec.width + 2.0f * padding) / font.texture.width,
+                                                     (rec.height + 2.0f * padding) / font.texture.height };
+            run->glyphCount++;
+        }
+
+        if (font.glyphs[index].advanceX == 0) offsetX += rec.width * scale + spacing;
+        else offsetX += font.glyphs[index].advanceX * scale + spacing;
+    }
+
+    Vector2 size = MeasureTextEx(font, run->text, (float)fontSize, spacing);
+    run->width = (int)size.x;
+    run->height = (int)size.y;
+}
+
+void DrawTextRun(const TextRun* run, int x, int y, Color color) {
+    if (run->glyphCount == 0) return;
+
+    // Room for the whole run up front so its glyphs end up in one contiguous batch
+    rlCheckRenderBatchLimit(4 * run->glyphCount);
+
+    rlSetTexture(GetFontDefault().texture.id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < run->glyphCount; i++) {
+            Rectangle quad = run->quads[i];
+            Rectangle uv = run->uvs[i];
+            float left = x + quad.x;
+            float top = y + quad.y;
+
+            // Same vertex order as DrawTexturePro()
+            rlTexCoord2f(uv.x, uv.y);
+            rlVertex2f(left, top);
+            rlTexCoord2f(uv.x, uv.y + uv.height);
+            rlVertex2f(left, top + quad.height);
+            rlTexCoord2f(uv.x + uv.width, uv.y + uv.height);
+            rlVertex2f(left + quad.width, top + quad.height);
+            rlTexCoord2f(uv.x + uv.width, uv.y);
+            rlVertex2f(left + quad.width, top);
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+const TextRun* GetTextRun(const char* text, int fontSize) {
+    if (fontSize < 10) fontSize = 10;
+
+    for (int i = 0; i < TEXT_RUN_CACHE_SIZE; i++) {
+        TextRun* run = &textRunCache[i];
+        if (IsTextRunOf(run, text, fontSize)) return run;
+    }
+
+    TextRun* run = &textRunCache[textRunCacheNext];
+    textRunCacheNext = (textRunCacheNext + 1) % TEXT_RUN_CACHE_SIZE;
+    SetTextRun(run, text, fontSize);
+    return run;
+}
 
 void DrawButton(Rectangle bounds, const char* text, bool selected) {
     Color color = selected ? GOLD : LIGHTGRAY;
@@ -9,8 +119,8 @@ void DrawButton(Rectangle bounds, const char* text, bool selected) {
     
     // Center text
     int fontSize = 20;
-    int textWidth = MeasureText(text, fontSize);
-    DrawText(text, (int)(bounds.x + (bounds.width - textWidth) / 2), (int)(bounds.y + (bounds.height - fontSize) / 2), fontSize, color);
+    const TextRun* run = GetTextRun(text, fontSize);
+    DrawTextRun(run, (int)(bounds.x + (bounds.width - run->width) / 2), (int)(bounds.y + (bounds.height - fontSize) / 2), color);
 }
 
 void DrawHealthBar(float health, float maxHealth, int x, int y, int width, int height) {
@@ -18,7 +128,7 @@ void DrawHealthBar(float health, float maxHealth, int x, int y, int width, int h
     if (maxHealth > 0) {
         DrawRectangle(x, y, (int)(width * (health / maxHealth)), height, RED);
     }
-    DrawText("Health", x + 5, y + 2, 10, WHITE);
+    DrawTextRun(GetTextRun("Health", 10), x + 5, y + 2, WHITE);
 }
 
 void DrawStaminaBar(float stamina, float maxStamina, int x, int y, int width, int height) {
@@ -26,5 +136,51 @@ void DrawStaminaBar(float stamina, float maxStamina, int x, int y, int width, in
     if (maxStamina > 0) {
         DrawRectangle(x, y, (int)(width * (stamina / maxStamina)), height, GREEN);
     }
-    DrawText("Stamina", x + 5, y + 2, 10, WHITE);
-}
\ No newline at end of file
+    DrawTextRun(GetTextRun("Stamina", 10), x + 5, y + 2, WHITE);
+}
+
+void DrawMemoryOverlay(int x, int y) {
+    // Allocation rate sampled over an interval, per-frame counts are too noisy to read
+    static double sampleTime = 0.0;
+    static MemoryStats sample = { 0 };
+    static float allocsPerSecond = 0.0f;
+    static float bytesPerSecond = 0.0f;
+
+    MemoryStats total = GetMemoryStats(MEMORY_TAG_ALL);
+    double time = GetTime();
+    if (time - sampleTime >= MEMORY_RATE_INTERVAL) {
+        if (sampleTime > 0.0) {
+            allocsPerSecond = (float)((total.totalCount - sample.totalCount) / (time - sampleTime));
+            bytesPerSecond = (float)((total.totalBytes - sample.totalBytes) / (time - sampleTime));
+        }
+        sample = total;
+        sampleTime = time;
+    }
+
+    FrameMemoryStats frame = GetFrameMemoryStats();
+    rlGpuMemoryStats gpu = rlGetGpuMemoryStats();
+    FramePacingStats pacing = GetFramePacingStats();
+    int lineHeight = 12;
+
+    DrawRectangle(x, y, 300, (MEMORY_TAG_ALL + 7) * lineHeight + 8, (Color){ 0, 0, 0, 180 });
+    x += 6;
+    y += 4;
+
+    DrawText("CPU         live KB   peak KB  allocs", x, y, 10, GOLD);
+    for (int tag = 0; tag <= MEMORY_TAG_ALL; tag++) {
+        MemoryStats stats = GetMemoryStats(tag);
+        y += lineHeight;
+        DrawText(TextFormat("%-10s %8lli  %8lli  %6u", GetMemoryTagName(tag), stats.liveBytes / 1024, stats.peakBytes / 1024, stats.liveCount), x, y, 10, (tag == MEMORY_TAG_ALL) ? WHITE : LIGHTGRAY);
+    }
+
+    y += lineHeight;
+    DrawText(TextFormat("Rate: %.0f allocs/s, %.1f KB/s", allocsPerSecond, bytesPerSecond / 1024.0f), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Frame: %u/%u KB (peak %u KB, overflows %u)", frame.used / 1024, frame.capacity / 1024, frame.peak / 1024, frame.overflows), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("GPU textures: %i (%lli KB)", gpu.textureCount, gpu.textureBytes / 1024), x, y, 10, SKYBLUE);
+    y += lineHeight;
+    DrawText(TextFormat("GPU buffers: %i (%lli KB)", gpu.bufferCount, gpu.bufferBytes / 1024), x, y, 10, SKYBLUE);
+    y += lineHeight;
+    DrawText(TextFormat("Pacing: %.1f%% missed, max late %.1f ms, spin %.2f ms", pacing.missRate * 100.0f, pacing.maxLateness * 1000.0f, pacing.spinMargin * 1000.0f), x, y, 10, LIME);
+}
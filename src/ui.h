@@ -3,6 +3,26 @@
 
 #include "raylib.h"
 
+#define TEXT_RUN_MAX_LENGTH 64      // Max text run length in bytes (including '\0'), longer strings are cut
+
+// Text laid out once with the default font, drawn as one quad batch until the string changes
+typedef struct TextRun {
+    char text[TEXT_RUN_MAX_LENGTH]; // String the run was built from
+    int fontSize;
+    int width;                      // Same as MeasureText()
+    int height;
+    int glyphCount;
+    Rectangle quads[TEXT_RUN_MAX_LENGTH];   // Glyph quads relative to the run position
+    Rectangle uvs[TEXT_RUN_MAX_LENGTH];     // Glyph texture coordinates in the font atlas
+} TextRun;
+
+// Lays out the text, does nothing if the run already holds the same string and size
+void SetTextRun(TextRun* run, const char* text, int fontSize);
+// Draws the run like DrawText() would at the same position
+void DrawTextRun(const TextRun* run, int x, int y, Color color);
+// Returns a shared run for a constant UI string (titles, buttons), built on first use
+const TextRun* GetTextRun(const char* text, int fontSize);
+
 // Draws a standard button. Returns true if it was clicked (logic handled externally usually, but this helper draws it)
 void DrawButton(Rectangle bounds, const char* text, bool selected);
 
@@ -12,4 +32,7 @@ void DrawHealthBar(float health, float maxHealth, int x, int y, int width, int h
 // Draws the stamina bar
 void DrawStaminaBar(float stamina, float maxStamina, int x, int y, int width, int height);
 
+// Draws raylib memory usage: CPU allocations by subsystem, allocation rate, frame memory and GPU resources (and frame pacing)
+void DrawMemoryOverlay(int x, int y);
+
 #endif
\ No newline at end of file
@@ -1,8 +1,29 @@
 #include "world.h"
 #include "raymath.h"
+#include "texgen.h"
 #include <math.h>
 
 void InitWorld(World* world) {
+    // Terrain is only built once, it's the same for every game
+    InitTerrain(&world->terrain);
+
+    if (!world->texturesLoaded) {
+        TexGenParams sky = { TEXGEN_SKY, 512, 3, 6.0f, 0, (Color){ 70, 130, 200, 255 }, SKYBLUE };
+        world->skyTexture = LoadProceduralTexture(sky);
+
+        Image props[PROP_TEXTURE_COUNT] = { 0 };
+        props[PROP_TEXTURE_BARK] = LoadProceduralImage((TexGenParams){ TEXGEN_BARK, 256, 11, 12.0f, 0, (Color){ 50, 38, 26, 255 }, (Color){ 110, 88, 62, 255 } });
+        world->propAtlas = LoadTextureAtlas(props, PROP_TEXTURE_COUNT, PROP_ATLAS_SIZE);
+        for (int i = 0; i < PROP_TEXTURE_COUNT; i++) UnloadImage(props[i]);
+
+        AtlasRegion bark = world->propAtlas.regions[PROP_TEXTURE_BARK];
+        world->trunkModel = LoadModelFromMesh(GenMeshCylinder(0.5f, 2.5f, 8));
+        RemapMeshTexcoords(&world->trunkModel.meshes[0], bark);
+        world->trunkModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = world->propAtlas.pages[bark.page];
+
+        world->texturesLoaded = true;
+    }
+
     // Initialize Trees scattered around
     for (int i = 0; i < MAX_TREES; i++) {
         world->trees[i].position = (Vector3){ 
@@ -10,6 +31,7 @@ void InitWorld(World* world) {
             0.0f, 
             (float)GetRandomValue(-10, 10) 
         };
+        world->trees[i].position.y = GetTerrainHeight(world->trees[i].position.x, world->trees[i].position.z);
     }
 
     // Initialize Bones
@@ -19,6 +41,7 @@ void InitWorld(World* world) {
             0.5f, 
             (float)GetRandomValue(-5, 5) 
         };
+        world->bones[i].position.y = GetTerrainHeight(world->bones[i].position.x, world->bones[i].position.z) + 0.5f;
         world->bones[i].active = true;
     }
 
@@ -29,6 +52,7 @@ void InitWorld(World* world) {
             0.5f, 
             (float)GetRandomValue(-5, 5) 
         };
+        world->meats[i].position.y = GetTerrainHeight(world->meats[i].position.x, world->meats[i].position.z) + 0.5f;
         world->meats[i].active = true;
     }
 
@@ -49,6 +73,7 @@ void InitWorld(World* world) {
             0.0f,
             (float)GetRandomValue(-60, 60)
         };
+        world->grass[i].position.y = GetTerrainHeight(world->grass[i].position.x, world->grass[i].position.z);
         world->grass[i].size = (float)GetRandomValue(5, 15) / 10.0f;
     }
 }
@@ -58,12 +83,16 @@ void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, fl
     // If an object gets too far from the player, move it to a new random spot nearby.
     float maxDistance = 60.0f;
 
+    // Stream terrain chunks around the player
+    UpdateTerrain(&world->terrain, *playerPos);
+
     for (int i = 0; i < MAX_TREES; i++) {
         if (Vector3Distance(world->trees[i].position, *playerPos) > maxDistance) {
             float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
             float dist = (float)GetRandomValue(40, 55);
             world->trees[i].position.x = playerPos->x + sinf(angle) * dist;
             world->trees[i].position.z = playerPos->z + cosf(angle) * dist;
+            world->trees[i].position.y = GetTerrainHeight(world->trees[i].position.x, world->trees[i].position.z);
         }
 
         // Tree Collision (Solid Object)
@@ -87,6 +116,7 @@ void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, fl
             float dist = (float)GetRandomValue(40, 55);
             world->bones[i].position.x = playerPos->x + sinf(angle) * dist;
             world->bones[i].position.z = playerPos->z + cosf(angle) * dist;
+            world->bones[i].position.y = GetTerrainHeight(world->bones[i].position.x, world->bones[i].position.z) + 0.5f;
             world->bones[i].active = true;
         }
 
@@ -111,6 +141,7 @@ void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, fl
             float dist = (float)GetRandomValue(40, 55);
             world->meats[i].position.x = playerPos->x + sinf(angle) * dist;
             world->meats[i].position.z = playerPos->z + cosf(angle) * dist;
+            world->meats[i].position.y = GetTerrainHeight(world->meats[i].position.x, world->meats[i].position.z) + 0.5f;
             world->meats[i].active = true;
         }
 
@@ -131,12 +162,17 @@ void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, fl
     }
 
     // Update Grass (Infinite)
+    // Distances for all the grass clumps are computed in a single batch (SIMD)
+    float grassDistances[MAX_GRASS];
+    Vector3DistanceSqrArray(&world->grass[0].position, sizeof(Grass), MAX_GRASS, *playerPos, grassDistances);
+
     for (int i = 0; i < MAX_GRASS; i++) {
-        if (Vector3Distance(world->grass[i].position, *playerPos) > maxDistance) {
+        if (grassDistances[i] > maxDistance*maxDistance) {
             float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
             float dist = (float)GetRandomValue(40, 55);
             world->grass[i].position.x = playerPos->x + sinf(angle) * dist;
             world->grass[i].position.z = playerPos->z + cosf(angle) * dist;
+            world->grass[i].position.y = GetTerrainHeight(world->grass[i].position.x, world->grass[i].position.z);
         }
     }
 
@@ -153,8 +189,8 @@ void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, fl
 }
 
 void DrawWorld3D(World* world) {
-    // Draw Ground Plane
-    DrawPlane((Vector3){0, 0, 0}, (Vector2){1000.0f, 1000.0f}, (Color){50, 160, 50, 255}); // Grassy Green
+    // Draw Ground (Terrain chunks)
+    DrawTerrain(&world->terrain);
 
     // Draw Grass (Ambient)
     for (int i = 0; i < MAX_GRASS; i++) {
@@ -183,7 +219,7 @@ void DrawWorld3D(World* world) {
         Vector3 pos = world->trees[i].position;
         
         // Main Trunk
-        DrawCylinderEx(pos, (Vector3){pos.x, pos.y + 2.5f, pos.z}, 0.6f, 0.4f, 8, DARKBROWN);
+        DrawModel(world->trunkModel, pos, 1.0f, WHITE);
         
         // Branches
         Vector3 branch1Start = {pos.x, pos.y + 1.5f, pos.z};
@@ -263,4 +299,22 @@ void DrawWorld3D(World* world) {
         DrawSphereEx((Vector3){pos.x, pos.y + size*0.3f, pos.z + size*0.7f}, size * 0.6f, 10, 10, cloudColor);
         DrawSphereEx((Vector3){pos.x, pos.y + size*0.2f, pos.z - size*0.7f}, size * 0.6f, 10, 10, cloudColor);
     }
+}
+
+void DrawWorldSky(World* world) {
+    Texture2D sky = world->skyTexture;
+    DrawTexturePro(sky, (Rectangle){ 0, 0, (float)sky.width, (float)sky.height },
+                   (Rectangle){ 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() }, (Vector2){ 0 }, 0.0f, WHITE);
+}
+
+void UnloadWorld(World* world) {
+    UnloadTerrain(&world->terrain);
+
+    if (world->texturesLoaded) {
+        UnloadTexture(world->skyTexture);
+        world->trunkModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ 0 }; // Owned by the atlas
+        UnloadModel(world->trunkModel);
+        UnloadTextureAtlas(world->propAtlas);
+        world->texturesLoaded = false;
+    }
 }
\ No newline at end of file
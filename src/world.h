@@ -3,6 +3,8 @@
 
 #include "raylib.h"
 #include "player.h"
+#include "terrain.h"
+#include "atlas.h"
 
 #define MAX_BONES 20
 #define MAX_TREES 20
@@ -10,6 +12,14 @@
 #define MAX_CLOUDS 30
 #define MAX_GRASS 1000
 
+#define PROP_ATLAS_SIZE 512
+
+// Prop textures in the atlas
+typedef enum PropTexture {
+    PROP_TEXTURE_BARK = 0,
+    PROP_TEXTURE_COUNT
+} PropTexture;
+
 typedef struct Bone {
     Vector3 position;
     bool active;
@@ -40,10 +50,19 @@ typedef struct World {
     Meat meats[MAX_MEATS];
     Cloud clouds[MAX_CLOUDS];
     Grass grass[MAX_GRASS];
+    Terrain terrain;
+
+    // Procedural textures (texgen.h), loaded once and kept across games
+    Texture2D skyTexture;
+    TextureAtlas propAtlas; // Prop textures share one page, so props draw without texture switches
+    Model trunkModel;
+    bool texturesLoaded;
 } World;
 
 void InitWorld(World* world);
 void UpdateWorld(World* world, Vector3* playerPos, int* score, float* health, float maxHealth);
+void DrawWorldSky(World* world);
 void DrawWorld3D(World* world);
+void UnloadWorld(World* world);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+// Image processing benchmark: runs the CPU image operations with the worker pool forced to 1 thread and to N threads
+// and prints megapixels per second for each, ImageResize() is not split in worker jobs and is kept as a reference
+// Build: gcc tools/image_bench.c -o image_bench -O2 -std=c99 -I raylib/src -L raylib/src -lraylib -lm -lpthread -ldl
+//        (Windows: -lopengl32 -lgdi32 -lwinmm instead of -ldl)
+// Usage: image_bench [threads] [size]    (threads 0: one per core, size in pixels of the square test image)
+#define _POSIX_C_SOURCE 199309L
+#include "raylib.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOGDI
+    #define NOUSER
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#define BENCH_MIN_SECONDS 0.5           // Each operation is repeated at least this long
+#define OP_COUNT 8
+
+static const char* opNames[OP_COUNT] = {
+    "BlurGaussian", "KernelConvolution", "ColorTint", "ColorContrast",
+    "ColorBrightness", "AlphaPremultiply", "Draw", "Resize (ref)"
+};
+
+// Wall clock seconds, clock() adds up the CPU time of every worker thread
+static double BenchTime(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+// Runs operation op once on a copy of source, copy time is excluded
+static double RunOp(int op, Image source, Image overlay) {
+    static const float kernel[9] = { 0.0f, -1.0f, 0.0f, -1.0f, 5.0f, -1.0f, 0.0f, -1.0f, 0.0f };
+    Image image = ImageCopy(source);
+
+    double start = BenchTime();
+    switch (op) {
+        case 0: ImageBlurGaussian(&image, 4); break;
+        case 1: ImageKernelConvolution(&image, kernel, 9); break;
+        case 2: ImageColorTint(&image, (Color){ 255, 180, 120, 255 }); break;
+        case 3: ImageColorContrast(&image, 40.0f); break;
+        case 4: ImageColorBrightness(&image, 30); break;
+        case 5: ImageAlphaPremultiply(&image); break;
+        case 6: ImageDraw(&image, overlay, (Rectangle){ 0, 0, (float)overlay.width, (float)overlay.height },
+                          (Rectangle){ 0, 0, (float)image.width, (float)image.height }, (Color){ 255, 255, 255, 200 }); break;
+        default: ImageResize(&image, image.width * 3 / 4, image.height * 3 / 4); break;
+    }
+    double time = BenchTime() - start;
+
+    UnloadImage(image);
+    return time;
+}
+
+// Megapixels per second of source processed by op, over repeated runs
+static double BenchOp(int op, Image source, Image overlay) {
+    double total = 0.0;
+    int runs = 0;
+    while ((total < BENCH_MIN_SECONDS) || (runs < 3)) {
+        total += RunOp(op, source, overlay);
+        runs++;
+    }
+    return (double)source.width * source.height * runs / total / 1e6;
+}
+
+static void BenchAll(int threads, Image source, Image overlay, double* results) {
+    SetWorkerThreadCount(threads);
+    for (int op = 0; op < OP_COUNT; op++) results[op] = BenchOp(op, source, overlay);
+}
+
+int main(int argc, char** argv) {
+    int threads = (argc > 1) ? atoi(argv[1]) : 0;
+    int size = (argc > 2) ? atoi(argv[2]) : 1024;
+    if (threads < 0) threads = 0;
+    if (size < 16) size = 16;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Alpha varies so premultiply and blending do real work
+    Image source = GenImageGradientRadial(size, size, 0.2f, (Color){ 230, 90, 40, 255 }, (Color){ 20, 60, 200, 120 });
+    Image overlay = GenImageChecked(size / 2, size / 2, 16, 16, (Color){ 250, 250, 250, 180 }, (Color){ 10, 10, 10, 90 });
+
+    double single[OP_COUNT] = { 0 };
+    double multi[OP_COUNT] = { 0 };
+    BenchAll(1, source, overlay, single);
+    BenchAll(threads, source, overlay, multi);
+
+    char multiName[32] = "per core";
+    if (threads > 0) snprintf(multiName, sizeof(multiName), "%i threads", threads);
+
+    printf("Image operations, %ix%i RGBA8, MP/s\n", size, size);
+    printf("  %-18s %10s %10s %8s\n", "operation", "1 thread", multiName, "speedup");
+    for (int op = 0; op < OP_COUNT; op++) {
+        printf("  %-18s %10.1f %10.1f %7.2fx\n", opNames[op], single[op], multi[op], multi[op] / single[op]);
+    }
+
+    CloseWorkerThreads();
+    UnloadImage(source);
+    UnloadImage(overlay);
+    return 0;
+}
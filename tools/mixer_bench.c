@@ -0,0 +1,100 @@
+// Mixer benchmark: drives the raudio mixing callback offline (no audio device) with 16, 64 and 256 looping voices
+// raudio.c is compiled into this program to reach the callback, the rest of raylib is linked as usual
+// Build: gcc tools/mixer_bench.c -o mixer_bench -O2 -std=c99 -I raylib/src -L raylib/src -lraylib -lm -lpthread -ldl
+//        (Windows: -lopengl32 -lgdi32 -lwinmm instead of -ldl), add -DAUDIO_MIXER_DISABLE_SIMD for the scalar mixer
+// Usage: mixer_bench [periods]
+#include "raudio.c"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_SAMPLE_RATE 48000
+#define BENCH_PERIOD_FRAMES 480         // 10 ms device period
+#define BENCH_VOLUME_INTERVAL 4         // Volumes change every few periods, gains ramp on those mixes
+
+#if defined(AUDIO_MIXER_SIMD_AVX)
+    #define MIXER_PATH "AVX"
+#elif defined(AUDIO_MIXER_SIMD_SSE)
+    #define MIXER_PATH "SSE"
+#elif defined(AUDIO_MIXER_SIMD_NEON)
+    #define MIXER_PATH "NEON"
+#else
+    #define MIXER_PATH "scalar"
+#endif
+
+static double BenchSeconds(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// Full callback: commands, data conversion, gains ramp and mixing of every voice
+static void BenchCallback(Wave wave, int voiceCount, int periods) {
+    static float out[BENCH_PERIOD_FRAMES * AUDIO_DEVICE_CHANNELS];
+    Sound* sounds = (Sound*)MemAlloc(voiceCount * sizeof(Sound));
+
+    for (int i = 0; i < voiceCount; i++) {
+        sounds[i] = LoadSoundFromWave(wave);
+        sounds[i].stream.buffer->looping = true;
+        SetSoundPan(sounds[i], (float)(i % 10) / 10.0f);
+        PlaySound(sounds[i]);
+    }
+
+    clock_t start = clock();
+    for (int p = 0; p < periods; p++) {
+        if ((p % BENCH_VOLUME_INTERVAL) == 0) {
+            for (int i = 0; i < voiceCount; i++) SetSoundVolume(sounds[i], 0.5f + 0.5f * (float)((p + i) % 7) / 7.0f);
+        }
+        OnSendAudioDataToDevice(&AUDIO.System.device, out, NULL, BENCH_PERIOD_FRAMES);
+    }
+    double time = BenchSeconds(start);
+
+    double periodTime = time / periods;
+    printf("  %3i voices: %7.2f us/period, %5.2f us/voice, %5.1f%% of a %i ms period\n", voiceCount, periodTime * 1e6, periodTime * 1e6 / voiceCount,
+           periodTime * 100.0 * BENCH_SAMPLE_RATE / BENCH_PERIOD_FRAMES, 1000 * BENCH_PERIOD_FRAMES / BENCH_SAMPLE_RATE);
+
+    for (int i = 0; i < voiceCount; i++) UnloadSound(sounds[i]);
+    MemFree(sounds);
+}
+
+// Mix kernel only: stereo accumulation with ramped gains, as done once per voice and period
+static void BenchKernel(int periods) {
+    static float in[BENCH_PERIOD_FRAMES * 2];
+    static float out[BENCH_PERIOD_FRAMES * 2];
+    for (int i = 0; i < BENCH_PERIOD_FRAMES * 2; i++) in[i] = sinf((float)i * 0.01f) * 0.1f;
+
+    float gains[2][2] = { { 0.25f, 0.75f }, { 0.75f, 0.25f } };
+    int mixes = periods * 64;
+
+    clock_t start = clock();
+    for (int m = 0; m < mixes; m++) MixAudioFramesStereo(out, in, BENCH_PERIOD_FRAMES, gains[m & 1], gains[(m + 1) & 1]);
+    double time = BenchSeconds(start);
+
+    printf("  kernel: %.1f Mframes/s (%.3f us per %i frames, out %.3f)\n", (double)mixes * BENCH_PERIOD_FRAMES / time / 1e6,
+           time * 1e6 / mixes, BENCH_PERIOD_FRAMES, out[0]);
+}
+
+int main(int argc, char** argv) {
+    int periods = (argc > 1) ? atoi(argv[1]) : 2000;
+    if (periods < 1) periods = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Device is never opened, the callback is called directly with the playback format it would use
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.playback.format = AUDIO_DEVICE_FORMAT;
+    AUDIO.System.device.sampleRate = BENCH_SAMPLE_RATE;
+
+    // One second stereo f32 tone, voices loop over it
+    int frameCount = BENCH_SAMPLE_RATE;
+    float* pcm = (float*)MemAlloc(frameCount * 2 * sizeof(float));
+    for (int i = 0; i < frameCount * 2; i++) pcm[i] = sinf((float)i * 0.01f) * 0.1f;
+    Wave wave = { (unsigned int)frameCount, BENCH_SAMPLE_RATE, 32, 2, pcm };
+
+    printf("raudio mixer, %s path, %i periods of %i frames\n", MIXER_PATH, periods, BENCH_PERIOD_FRAMES);
+
+    int voiceCounts[3] = { 16, 64, 256 };
+    for (int i = 0; i < 3; i++) BenchCallback(wave, voiceCounts[i], periods);
+    BenchKernel(periods);
+
+    MemFree(pcm);
+    return 0;
+}
@@ -0,0 +1,20 @@
+// Pack builder: packs assets/ into the archive the game mounts at startup
+// Usage: pack_builder [assetsDir] [archiveFile] [--store]
+#include "raylib.h"
+#include "pack.h"
+#include <string.h>
+
+int main(int argc, char** argv) {
+    const char* dirPath = "assets";
+    const char* fileName = PACK_FILE_NAME;
+    bool compress = true;
+
+    int positional = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--store") == 0) compress = false;
+        else if (positional == 0) { dirPath = argv[i]; positional++; }
+        else if (positional == 1) { fileName = argv[i]; positional++; }
+    }
+
+    return BuildPack(dirPath, fileName, compress) ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+// raymath batch test: checks Vector3*Array() batch functions against the single Vector3 functions
+// and measures their throughput against a per-element loop
+// The SIMD path is selected at compile time, build once per path:
+//   AVX2:   gcc tools/raymath_test.c -o raymath_test -O2 -std=c99 -mavx2 -I raylib/src -lm
+//   SSE2:   gcc tools/raymath_test.c -o raymath_test -O2 -std=c99 -I raylib/src -lm   (x86-64 default)
+//   NEON:   gcc tools/raymath_test.c -o raymath_test -O2 -std=c99 -I raylib/src -lm   (AArch64 default)
+//   Scalar: gcc tools/raymath_test.c -o raymath_test -O2 -std=c99 -DRAYMATH_DISABLE_SIMD -I raylib/src -lm
+// Usage: raymath_test [benchmarkPoints]
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(RAYMATH_SIMD_AVX2)
+    #define SIMD_PATH "AVX2"
+#elif defined(RAYMATH_SIMD_SSE2)
+    #define SIMD_PATH "SSE2"
+#elif defined(RAYMATH_SIMD_NEON)
+    #define SIMD_PATH "NEON"
+#else
+    #define SIMD_PATH "scalar"
+#endif
+
+#define MAX_TEST_POINTS 1100
+#define MAX_TEST_STRIDE 32
+#define BUFFER_SIZE (MAX_TEST_POINTS * MAX_TEST_STRIDE + 64)
+#define SENTINEL 0xA5               // Output bytes not belonging to a result must keep this value
+
+static const int testStrides[] = { 0, 12, 16, 20, 32, 14 };    // 0 is packed, 14 is not a multiple of 4 (scalar fallback)
+static const int testOffsets[] = { 0, 4, 8, 12 };               // Byte offsets from a 32 byte aligned buffer
+static const int testCounts[] = { 1000, 1001, 1023, 1024, 1025, 1099 };
+
+static int failures = 0;
+
+static float RandomFloat(void) {
+    return (float)rand() / (float)RAND_MAX * 200.0f - 100.0f;
+}
+
+// Stride 0 means packed points, as in the batch functions
+static int StrideStep(int stride) {
+    return (stride != 0) ? stride : (int)sizeof(Vector3);
+}
+
+static const Vector3* PointAt(const unsigned char* base, int stride, int i) {
+    return (const Vector3*)(base + (size_t)i * StrideStep(stride));
+}
+
+static void Fail(const char* name, int count, int stride, int offset, int index, const char* what) {
+    if (failures < 20) printf("FAIL %s count %i stride %i offset %i: %s at %i\n", name, count, stride, offset, what, index);
+    failures++;
+}
+
+static bool SameFloat(float a, float b) {
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// Output bytes outside the result elements (stride padding and past the last element) must be untouched
+static void CheckUntouched(const char* name, const unsigned char* out, int count, int stride, int offset, int elementSize) {
+    int step = StrideStep(stride);
+    for (int b = 0; b < BUFFER_SIZE - offset; b++) {
+        bool inside = (b < count * step) && ((b % step) < elementSize);
+        if (!inside && (out[b] != SENTINEL)) {
+            Fail(name, count, stride, offset, b, "byte written outside results");
+            return;
+        }
+    }
+}
+
+static void TestCase(const unsigned char* in, unsigned char* outBuffer, int count, int stride, int offset, Matrix mat, Vector3 target) {
+    unsigned char* out = outBuffer + offset;
+
+    // Vector3TransformArray() against Vector3Transform()
+    memset(outBuffer, SENTINEL, BUFFER_SIZE);
+    Vector3TransformArray((const Vector3*)in, stride, count, mat, (Vector3*)out, stride);
+    for (int i = 0; i < count; i++) {
+        Vector3 expected = Vector3Transform(*PointAt(in, stride, i), mat);
+        const Vector3* r = PointAt(out, stride, i);
+        if (!SameFloat(r->x, expected.x) || !SameFloat(r->y, expected.y) || !SameFloat(r->z, expected.z)) {
+            Fail("Vector3TransformArray", count, stride, offset, i, "result differs from Vector3Transform()");
+            break;
+        }
+    }
+    CheckUntouched("Vector3TransformArray", out, count, stride, offset, (int)sizeof(Vector3));
+
+    // Vector3NormalizeArray() against Vector3Normalize()
+    memset(outBuffer, SENTINEL, BUFFER_SIZE);
+    Vector3NormalizeArray((const Vector3*)in, stride, count, (Vector3*)out, stride);
+    for (int i = 0; i < count; i++) {
+        Vector3 expected = Vector3Normalize(*PointAt(in, stride, i));
+        const Vector3* r = PointAt(out, stride, i);
+        if (!SameFloat(r->x, expected.x) || !SameFloat(r->y, expected.y) || !SameFloat(r->z, expected.z)) {
+            Fail("Vector3NormalizeArray", count, stride, offset, i, "result differs from Vector3Normalize()");
+            break;
+        }
+    }
+    CheckUntouched("Vector3NormalizeArray", out, count, stride, offset, (int)sizeof(Vector3));
+
+    // Vector3DistanceSqrArray() against Vector3DistanceSqr(), packed float output
+    memset(outBuffer, SENTINEL, BUFFER_SIZE);
+    Vector3DistanceSqrArray((const Vector3*)in, stride, count, target, (float*)out);
+    for (int i = 0; i < count; i++) {
+        if (!SameFloat(((const float*)out)[i], Vector3DistanceSqr(*PointAt(in, stride, i), target))) {
+            Fail("Vector3DistanceSqrArray", count, stride, offset, i, "result differs from Vector3DistanceSqr()");
+            break;
+        }
+    }
+    CheckUntouched("Vector3DistanceSqrArray", out, count, (int)sizeof(float), offset, (int)sizeof(float));
+
+    // Vector3MinMaxArray() against Vector3Min()/Vector3Max()
+    if (count > 0) {
+        Vector3 min = { 0 }, max = { 0 };
+        Vector3MinMaxArray((const Vector3*)in, stride, count, &min, &max);
+        Vector3 expectedMin = *PointAt(in, stride, 0), expectedMax = expectedMin;
+        for (int i = 1; i < count; i++) {
+            expectedMin = Vector3Min(expectedMin, *PointAt(in, stride, i));
+            expectedMax = Vector3Max(expectedMax, *PointAt(in, stride, i));
+        }
+        if (!Vector3Equals(min, expectedMin) || !Vector3Equals(max, expectedMax)) Fail("Vector3MinMaxArray", count, stride, offset, -1, "bounds differ from Vector3Min()/Vector3Max()");
+    }
+}
+
+static void RunTests(void) {
+    unsigned char* inBuffer = (unsigned char*)malloc(BUFFER_SIZE + 32);
+    unsigned char* outBuffer = (unsigned char*)malloc(BUFFER_SIZE + 32);
+    unsigned char* inAligned = inBuffer + (32 - ((size_t)inBuffer % 32)) % 32;
+    unsigned char* outAligned = outBuffer + (32 - ((size_t)outBuffer % 32)) % 32;
+
+    Matrix mat = MatrixMultiply(MatrixMultiply(MatrixScale(1.5f, -2.0f, 0.75f), MatrixRotateXYZ((Vector3){ 0.3f, -1.1f, 2.0f })), MatrixTranslate(4.0f, -7.5f, 12.25f));
+    Vector3 target = { 3.5f, -1.25f, 8.0f };
+    int cases = 0;
+
+    for (int s = 0; s < (int)(sizeof(testStrides) / sizeof(int)); s++) {
+        for (int o = 0; o < (int)(sizeof(testOffsets) / sizeof(int)); o++) {
+            unsigned char* in = inAligned + testOffsets[o];
+            for (int b = 0; b < BUFFER_SIZE - testOffsets[o]; b++) in[b] = (unsigned char)rand();
+            for (int i = 0; i < MAX_TEST_POINTS; i++) {
+                Vector3* p = (Vector3*)PointAt(in, testStrides[s], i);
+                // Some zero vectors, normalize keeps them unchanged
+                *p = ((i % 17) == 5) ? (Vector3){ 0 } : (Vector3){ RandomFloat(), RandomFloat(), RandomFloat() };
+            }
+
+            // Every count up to a few SIMD blocks (tails of all sizes), then longer arrays
+            for (int count = 0; count <= 67; count++, cases++) TestCase(in, outAligned, count, testStrides[s], testOffsets[o], mat, target);
+            for (int c = 0; c < (int)(sizeof(testCounts) / sizeof(int)); c++, cases++) TestCase(in, outAligned, testCounts[c], testStrides[s], testOffsets[o], mat, target);
+        }
+    }
+
+    printf("Correctness: %i cases, %i failures\n", cases, failures);
+
+    free(inBuffer);
+    free(outBuffer);
+}
+
+static double BenchSeconds(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void RunBenchmark(int count) {
+    Vector3* points = (Vector3*)malloc((size_t)count * sizeof(Vector3));
+    Vector3* result = (Vector3*)malloc((size_t)count * sizeof(Vector3));
+    float* distances = (float*)malloc((size_t)count * sizeof(float));
+    for (int i = 0; i < count; i++) points[i] = (Vector3){ RandomFloat(), RandomFloat(), RandomFloat() };
+
+    Matrix mat = MatrixRotateXYZ((Vector3){ 0.3f, -1.1f, 2.0f });
+    mat.m12 = 4.0f;
+    Vector3 target = { 1.0f, 2.0f, 3.0f };
+    int iterations = (int)(200000000LL / count) + 1;
+    volatile float sink = 0.0f;
+
+    printf("Throughput (%i packed points, Mpoints/s):\n", count);
+    printf("  %-12s %10s %10s %8s\n", "function", "loop", "batch", "speedup");
+
+    for (int f = 0; f < 4; f++) {
+        clock_t start = clock();
+        for (int it = 0; it < iterations; it++) {
+            switch (f) {
+                case 0: for (int i = 0; i < count; i++) result[i] = Vector3Transform(points[i], mat); break;
+                case 1: for (int i = 0; i < count; i++) result[i] = Vector3Normalize(points[i]); break;
+                case 2: for (int i = 0; i < count; i++) distances[i] = Vector3DistanceSqr(points[i], target); break;
+                default: {
+                    Vector3 min = points[0], max = points[0];
+                    for (int i = 1; i < count; i++) { min = Vector3Min(min, points[i]); max = Vector3Max(max, points[i]); }
+                    result[0] = min; result[1] = max;
+                } break;
+            }
+            sink += result[it % count].x + distances[it % count];
+        }
+        double loopTime = BenchSeconds(start);
+
+        start = clock();
+        for (int it = 0; it < iterations; it++) {
+            switch (f) {
+                case 0: Vector3TransformArray(points, 0, count, mat, result, 0); break;
+                case 1: Vector3NormalizeArray(points, 0, count, result, 0); break;
+                case 2: Vector3DistanceSqrArray(points, 0, count, target, distances); break;
+                default: Vector3MinMaxArray(points, 0, count, &result[0], &result[1]); break;
+            }
+            sink += result[it % count].x + distances[it % count];
+        }
+        double batchTime = BenchSeconds(start);
+
+        static const char* names[4] = { "Transform", "Normalize", "DistanceSqr", "MinMax" };
+        double total = (double)count * iterations / 1000000.0;
+        printf("  %-12s %10.1f %10.1f %7.2fx\n", names[f], total / loopTime, total / batchTime, loopTime / batchTime);
+    }
+
+    free(points);
+    free(result);
+    free(distances);
+}
+
+int main(int argc, char** argv) {
+    int benchmarkPoints = (argc > 1) ? atoi(argv[1]) : 4096;
+    if (benchmarkPoints < 2) benchmarkPoints = 2;
+
+    srand(1234);
+    printf("raymath batch functions, %s path\n", SIMD_PATH);
+
+    RunTests();
+    RunBenchmark(benchmarkPoints);
+
+    return (failures == 0) ? 0 : 1;
+}